@@ -0,0 +1,114 @@
+#include "Async.hpp"
+#include "Primality.hpp"
+#include "RadixConversion.hpp"
+
+namespace helper {
+
+    /**
+     * Friend class of BigInt: DivModAsync returns both parts of DivMod.
+     */
+    class Async final {
+    public:
+
+        static std::pair<BigInt, BigInt> DivMod(const BigInt& lhs, const BigInt& rhs) {
+            return lhs.DivMod(rhs);
+        }
+    };
+}
+
+namespace {
+    thread_local OperationContext* current { nullptr };
+}
+
+OperationContext::OperationContext(CancellationToken token, ProgressCallback progress) :
+    m_token { std::move(token) },
+    m_progress { std::move(progress) },
+    m_outer { current },
+    m_low { 0 },
+    m_width { 1 },
+    m_reported { 0 }
+{
+    this->Checkpoint();
+    current = this;
+}
+
+OperationContext::~OperationContext() {
+    current = m_outer;
+}
+
+OperationContext* OperationContext::Current() noexcept {
+    return current;
+}
+
+void OperationContext::Checkpoint() const {
+    if( m_token.IsCancelled() ) {
+        throw OperationCancelled{};
+    }
+}
+
+void OperationContext::Report(double fraction) {
+    if( m_progress && fraction > m_reported ) {
+        m_reported = fraction;
+        m_progress(fraction);
+    }
+}
+
+ProgressScope::ProgressScope(size_t steps) :
+    m_context { current },
+    m_steps { std::max<size_t>(steps, 1) },
+    m_step { 0 },
+    m_low { m_context? m_context->m_low: 0 },
+    m_width { m_context? m_context->m_width: 0 }
+{
+    if( m_context ) {
+        m_context->Checkpoint();
+        m_context->m_width = m_width / m_steps;
+    }
+}
+
+ProgressScope::~ProgressScope() {
+    if( m_context ) {
+        m_context->m_low = m_low;
+        m_context->m_width = m_width;
+    }
+}
+
+void ProgressScope::Step() {
+    if( !m_context ) {
+        return;
+    }
+    m_step = std::min(m_step + 1, m_steps);
+    m_context->m_low = m_low + m_width * m_step / m_steps;
+    m_context->Report(m_context->m_low);
+    m_context->Checkpoint();
+}
+
+std::future<BigInt> MultiplyAsync(BigInt lhs, BigInt rhs, AsyncOptions options) {
+    return RunAsync(std::move(options), [lhs = std::move(lhs), rhs = std::move(rhs)]() {
+        return lhs * rhs;
+    });
+}
+
+std::future<std::pair<BigInt, BigInt>> DivModAsync(BigInt lhs, BigInt rhs, AsyncOptions options) {
+    return RunAsync(std::move(options), [lhs = std::move(lhs), rhs = std::move(rhs)]() {
+        return helper::Async::DivMod(lhs, rhs);
+    });
+}
+
+std::future<BigInt> PowModAsync(BigInt base, BigInt exponent, BigInt modulus, AsyncOptions options) {
+    return RunAsync(std::move(options), [base = std::move(base), exponent = std::move(exponent), modulus = std::move(modulus)]() {
+        return PowMod(base, exponent, modulus);
+    });
+}
+
+std::future<std::string> ToRadixStringAsync(BigInt value, unsigned radix, AsyncOptions options) {
+    return RunAsync(std::move(options), [value = std::move(value), radix]() {
+        return ToRadixString(value, radix);
+    });
+}
+
+std::future<BigInt> FromRadixStringAsync(std::string text, unsigned radix, AsyncOptions options) {
+    return RunAsync(std::move(options), [text = std::move(text), radix]() {
+        return FromRadixString(text, radix);
+    });
+}
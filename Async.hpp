@@ -0,0 +1,213 @@
+#pragma once
+
+#include "BigInt.hpp"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+
+/**
+ * Asynchronous execution of long operations with cooperative cancellation and progress.
+ * The operation runs on an executor with an OperationContext installed on its thread.
+ * Loops and recursions of the heavy algorithms (Karatsuba subproblems of huge products,
+ * blocks of Newton's and Knuth's divisions, windows of PowMod, halves of radix conversions)
+ * open a ProgressScope and call Step() at their boundaries: it reports the estimated
+ * fraction of the work done and throws OperationCancelled once the token is cancelled.
+ * Without a context the scopes cost a thread-local check.
+ */
+
+/**
+ * Thrown into the future of a cancelled operation.
+ */
+class OperationCancelled final : public std::runtime_error {
+public:
+
+    OperationCancelled() :
+        std::runtime_error { "BigInt: operation cancelled" }
+    {
+    }
+};
+
+/**
+ * Cancellation flag, copies share it.
+ */
+class CancellationToken final {
+public:
+
+    CancellationToken() :
+        m_isCancelled { std::make_shared<std::atomic<bool>>(false) }
+    {
+    }
+
+    void Cancel() const noexcept {
+        m_isCancelled->store(true, std::memory_order_relaxed);
+    }
+
+    bool IsCancelled() const noexcept {
+        return m_isCancelled->load(std::memory_order_relaxed);
+    }
+
+private:
+
+    std::shared_ptr<std::atomic<bool>> m_isCancelled;
+};
+
+/**
+ * Receives the estimated fraction of work done in [0, 1] on the thread of the operation.
+ */
+using ProgressCallback = std::function<void(double)>;
+
+/**
+ * Runs the task somewhere, e.g. on a thread pool of the application.
+ */
+using Executor = std::function<void(std::function<void()>)>;
+
+/**
+ * Runs each task on a new detached thread, opt-in: the thread outlives an abandoned future
+ * and must not be running at the exit from main.
+ */
+inline void DetachedThreadExecutor(std::function<void()> task) {
+    std::thread { std::move(task) }.detach();
+}
+
+/**
+ * Runs the task on the calling thread, the future is ready on return.
+ */
+inline void InlineExecutor(std::function<void()> task) {
+    task();
+}
+
+/**
+ * Without an executor the operation runs by std::async(std::launch::async):
+ * the future owns the thread, its destructor waits for the operation.
+ */
+struct AsyncOptions {
+    Executor executor;
+    CancellationToken token;
+    ProgressCallback progress;
+};
+
+/**
+ * Cancellation token and progress callback of the operation running on this thread.
+ * Contexts nest: an inner one is restored to the outer one on destruction.
+ */
+class OperationContext final {
+public:
+
+    /**
+     * Throws OperationCancelled if the token is cancelled already.
+     */
+    OperationContext(CancellationToken token, ProgressCallback progress);
+    ~OperationContext();
+
+    OperationContext(const OperationContext&) = delete;
+    OperationContext& operator=(const OperationContext&) = delete;
+
+    /**
+     * Context of this thread or nullptr.
+     */
+    static OperationContext* Current() noexcept;
+
+    /**
+     * Throws OperationCancelled if the token is cancelled.
+     */
+    void Checkpoint() const;
+
+    /**
+     * Reports the fraction if it's greater than the last reported one.
+     */
+    void Report(double fraction);
+
+private:
+
+    friend class ProgressScope;
+
+    CancellationToken m_token;
+    ProgressCallback m_progress;
+    OperationContext* m_outer;
+    // the running scope covers [m_low, m_low + m_width) of the whole work
+    double m_low;
+    double m_width;
+    double m_reported;
+};
+
+/**
+ * Part of work divided into @steps equal steps, nested scopes divide the current step.
+ */
+class ProgressScope final {
+public:
+
+    explicit ProgressScope(size_t steps);
+    ~ProgressScope();
+
+    ProgressScope(const ProgressScope&) = delete;
+    ProgressScope& operator=(const ProgressScope&) = delete;
+
+    /**
+     * The current step is done: reports progress and throws OperationCancelled if cancelled.
+     */
+    void Step();
+
+private:
+
+    OperationContext* m_context;
+    size_t m_steps;
+    size_t m_step;
+    double m_low;
+    double m_width;
+};
+
+/**
+ * Runs function() by options.executor (std::async if it's empty) with an OperationContext of options' token and progress,
+ * the future gets the result or the exception, OperationCancelled if cancelled.
+ */
+template<typename Function>
+auto RunAsync(AsyncOptions options, Function function) -> std::future<decltype(function())> {
+    using Result = decltype(function());
+    auto task = [function = std::move(function), token = options.token, progress = options.progress]() {
+        OperationContext context { token, progress };
+        auto result { function() };
+        context.Report(1.0);
+        return result;
+    };
+    if( !options.executor ) {
+        return std::async(std::launch::async, std::move(task));
+    }
+    auto promise { std::make_shared<std::promise<Result>>() };
+    auto future { promise->get_future() };
+    options.executor([promise, task = std::move(task)]() {
+        try {
+            promise->set_value(task());
+        }
+        catch(...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+    return future;
+}
+
+/**
+ * lhs * rhs, long products (by the product of sizes, also unbalanced ones) are multiplied
+ * by Karatsuba's step or by blocks on BigInt level with checks between the subproblems.
+ */
+std::future<BigInt> MultiplyAsync(BigInt lhs, BigInt rhs, AsyncOptions options = {});
+
+/**
+ * (lhs / rhs, lhs % rhs) like operator/ and operator%, checked after each block of quotient's coefficients.
+ */
+std::future<std::pair<BigInt, BigInt>> DivModAsync(BigInt lhs, BigInt rhs, AsyncOptions options = {});
+
+/**
+ * PowMod(base, exponent, modulus), checked after each window of exponent's bits.
+ */
+std::future<BigInt> PowModAsync(BigInt base, BigInt exponent, BigInt modulus, AsyncOptions options = {});
+
+/**
+ * ToRadixString(value, radix).
+ */
+std::future<std::string> ToRadixStringAsync(BigInt value, unsigned radix, AsyncOptions options = {});
+
+/**
+ * FromRadixString(text, radix).
+ */
+std::future<BigInt> FromRadixStringAsync(std::string text, unsigned radix, AsyncOptions options = {});
@@ -0,0 +1,188 @@
+#include "BigDecimal.hpp"
+
+BigDecimal::BigDecimal(BigInt unscaled, size_t scale) :
+    m_unscaled { std::move(unscaled) },
+    m_scale { scale }
+{
+}
+
+BigDecimal::BigDecimal(const std::string& number) :
+    m_scale { 0 }
+{
+    std::string_view sv { number };
+    const bool isNegative { !sv.empty() && sv.front() == '-' };
+    if( !sv.empty() && (sv.front() == '-' || sv.front() == '+') ) {
+        sv.remove_prefix(1);
+    }
+    const auto point { sv.find('.') };
+    std::string digits { sv.substr(0, point) };
+    if( point != std::string_view::npos ) {
+        m_scale = sv.size() - point - 1;
+        digits += sv.substr(point + 1);
+    }
+    if( digits.empty() || digits.find_first_not_of("0123456789") != std::string::npos ) {
+        throw std::domain_error("BigDecimal: invalid number");
+    }
+    // BigInt's parser keeps leading zero coefficients
+    digits.erase(0, std::min(digits.find_first_not_of('0'), digits.size() - 1));
+    m_unscaled = BigInt{ digits };
+    if( isNegative && !m_unscaled.IsZero() ) {
+        -m_unscaled;
+    }
+}
+
+void BigDecimal::SetScale(size_t scale, RoundingMode mode) {
+    if( scale >= m_scale ) {
+        m_unscaled.ScaleByPow10(scale - m_scale);
+        m_scale = scale;
+        return;
+    }
+    const auto dropped { m_scale - scale };
+    const bool isPositive { m_unscaled.IsPositive() };
+    // the highest dropped digit and whether any lower one isn't zero decide the rounding
+    const auto first { m_unscaled.Digit(dropped - 1) };
+    const bool isSticky { HasNonZeroDigits(m_unscaled, dropped - 1) };
+    m_unscaled.TruncDivPow10(dropped);
+    m_scale = scale;
+
+    bool isIncremented { false };
+    switch( mode ) {
+        case RoundingMode::Down:
+            break;
+        case RoundingMode::Up:
+            isIncremented = first || isSticky;
+            break;
+        case RoundingMode::Floor:
+            isIncremented = !isPositive && (first || isSticky);
+            break;
+        case RoundingMode::Ceiling:
+            isIncremented = isPositive && (first || isSticky);
+            break;
+        case RoundingMode::HalfDown:
+            isIncremented = first > 5 || (first == 5 && isSticky);
+            break;
+        case RoundingMode::HalfUp:
+            isIncremented = first >= 5;
+            break;
+        case RoundingMode::HalfEven:
+            isIncremented = first > 5 || (first == 5 && (isSticky || m_unscaled.Digit(0) % 2));
+            break;
+    }
+    // the magnitude is incremented, the truncated value may be zero already
+    if( isIncremented ) {
+        m_unscaled += BigInt{ isPositive? 1: -1 };
+    }
+}
+
+void BigDecimal::Add(const BigDecimal& rhs, bool isAddition) {
+    if( m_scale < rhs.m_scale ) {
+        m_unscaled.ScaleByPow10(rhs.m_scale - m_scale);
+        m_scale = rhs.m_scale;
+    }
+    if( rhs.m_scale < m_scale ) {
+        auto addend { rhs.m_unscaled };
+        addend.ScaleByPow10(m_scale - rhs.m_scale);
+        if( isAddition ) {
+            m_unscaled += addend;
+        }
+        else {
+            m_unscaled -= addend;
+        }
+        return;
+    }
+    if( isAddition ) {
+        m_unscaled += rhs.m_unscaled;
+    }
+    else {
+        m_unscaled -= rhs.m_unscaled;
+    }
+}
+
+void BigDecimal::operator += (const BigDecimal& rhs) {
+    this->Add(rhs, true);
+}
+
+void BigDecimal::operator -= (const BigDecimal& rhs) {
+    this->Add(rhs, false);
+}
+
+void BigDecimal::operator *= (const BigDecimal& rhs) {
+    m_unscaled *= rhs.m_unscaled;
+    m_scale += rhs.m_scale;
+}
+
+bool BigDecimal::HasNonZeroDigits(const BigInt& value, size_t count) noexcept {
+    const auto& coefficients { value.m_coefficients };
+    const auto whole { std::min(count / BigInt::DIGIT_COUNT, coefficients.size()) };
+    const auto last { coefficients.cbegin() + whole };
+    if( std::any_of(coefficients.cbegin(), last, [](auto c) { return c != 0; }) ) {
+        return true;
+    }
+    return last != coefficients.cend() && *last % BigInt::POWERS_OF_TEN[count % BigInt::DIGIT_COUNT];
+}
+
+BigInt BigDecimal::Difference(const BigDecimal& lhs, const BigDecimal& rhs) {
+    auto difference { lhs };
+    difference -= rhs;
+    return difference.m_unscaled;
+}
+
+void BigDecimal::Print(std::ostream& os) const {
+    auto magnitude { m_unscaled };
+    magnitude.m_isPositive = true;
+    std::ostringstream unscaled;
+    unscaled << magnitude;
+    auto digits { unscaled.str() };
+    if( digits.size() <= m_scale ) {
+        digits.insert(0, m_scale + 1 - digits.size(), '0');
+    }
+    if( m_scale ) {
+        digits.insert(digits.size() - m_scale, 1, '.');
+    }
+    if( !this->IsPositive() ) {
+        os << '-';
+    }
+    os << digits;
+}
+
+BigDecimal operator+ (const BigDecimal& lhs, const BigDecimal& rhs) {
+    auto x { lhs };
+    x += rhs;
+    return x;
+}
+
+BigDecimal operator- (const BigDecimal& lhs, const BigDecimal& rhs) {
+    auto x { lhs };
+    x -= rhs;
+    return x;
+}
+
+BigDecimal operator* (const BigDecimal& lhs, const BigDecimal& rhs) {
+    auto x { lhs };
+    x *= rhs;
+    return x;
+}
+
+bool operator== (const BigDecimal& lhs, const BigDecimal& rhs) {
+    if( lhs.m_scale == rhs.m_scale ) {
+        return lhs.m_unscaled == rhs.m_unscaled;
+    }
+    return BigDecimal::Difference(lhs, rhs).IsZero();
+}
+
+bool operator!= (const BigDecimal& lhs, const BigDecimal& rhs) {
+    return !(lhs == rhs);
+}
+
+bool operator< (const BigDecimal& lhs, const BigDecimal& rhs) {
+    return !BigDecimal::Difference(lhs, rhs).IsPositive();
+}
+
+bool operator> (const BigDecimal& lhs, const BigDecimal& rhs) {
+    return rhs < lhs;
+}
+
+std::ostream& operator<<(std::ostream& os, const BigDecimal& x) {
+    x.Print(os);
+    return os;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "BigInt.hpp"
+
+/**
+ * How dropped digits are rounded, like java.math.RoundingMode.
+ */
+enum class RoundingMode {
+    Down,       // toward zero
+    Up,         // away from zero
+    Floor,      // toward negative infinity
+    Ceiling,    // toward positive infinity
+    HalfDown,   // to nearest, ties toward zero
+    HalfUp,     // to nearest, ties away from zero
+    HalfEven    // to nearest, ties to the even digit
+};
+
+/**
+ * Decimal fixed-point number unscaled * 10^(-scale).
+ * Addition, substraction and multiplication are exact, rescaling is done
+ * by BigInt::ScaleByPow10 and BigInt::TruncDivPow10, so no general division is needed.
+ */
+class BigDecimal final {
+public:
+
+    BigDecimal(BigInt unscaled = BigInt{}, size_t scale = 0);
+
+    /**
+     * Parses "[-+]digits[.digits]", the scale is the number of digits after the point:
+     * "-12.500" is -12500 * 10^(-3).
+     * Throws std::domain_error for other strings.
+     */
+    explicit BigDecimal(const std::string& number);
+
+    const BigInt& Unscaled() const noexcept {
+        return m_unscaled;
+    }
+
+    size_t Scale() const noexcept {
+        return m_scale;
+    }
+
+    /**
+     * Number of decimal digits of the unscaled value.
+     */
+    size_t Precision() const noexcept {
+        return m_unscaled.DigitCount();
+    }
+
+    bool IsPositive() const noexcept {
+        return m_unscaled.IsPositive();
+    }
+
+    bool IsZero() const noexcept {
+        return m_unscaled.IsZero();
+    }
+
+    /**
+     * Changes the number of digits after the point, dropped digits are rounded by @mode.
+     */
+    void SetScale(size_t scale, RoundingMode mode = RoundingMode::HalfEven);
+
+    void operator += (const BigDecimal& rhs);
+    void operator -= (const BigDecimal& rhs);
+
+    /**
+     * The scale of the product is the sum of the scales.
+     */
+    void operator *= (const BigDecimal& rhs);
+
+    friend bool operator== (const BigDecimal& lhs, const BigDecimal& rhs);
+    friend bool operator<  (const BigDecimal& lhs, const BigDecimal& rhs);
+
+    friend std::ostream& operator<<(std::ostream& os, const BigDecimal& x);
+
+private:
+
+    /**
+     * *this += rhs or *this -= rhs if !isAddition.
+     */
+    void Add(const BigDecimal& rhs, bool isAddition);
+
+    /**
+     * Whether any of the lowest @count digits of the absolute value isn't zero.
+     */
+    static bool HasNonZeroDigits(const BigInt& value, size_t count) noexcept;
+
+    /**
+     * lhs - rhs with the scale of the larger one.
+     */
+    static BigInt Difference(const BigDecimal& lhs, const BigDecimal& rhs);
+
+    void Print(std::ostream& os) const;
+
+    BigInt m_unscaled;
+    size_t m_scale;
+};
+
+BigDecimal operator+ (const BigDecimal& lhs, const BigDecimal& rhs);
+BigDecimal operator- (const BigDecimal& lhs, const BigDecimal& rhs);
+BigDecimal operator* (const BigDecimal& lhs, const BigDecimal& rhs);
+
+/**
+ * Compare values regardless of scales: 1.50 == 1.5.
+ */
+bool operator== (const BigDecimal& lhs, const BigDecimal& rhs);
+bool operator!= (const BigDecimal& lhs, const BigDecimal& rhs);
+bool operator<  (const BigDecimal& lhs, const BigDecimal& rhs);
+bool operator>  (const BigDecimal& lhs, const BigDecimal& rhs);
+
+/**
+ * Prints all digits of the scale: "-12.500".
+ */
+std::ostream& operator<<(std::ostream& os, const BigDecimal& x);
@@ -0,0 +1,299 @@
+#include "BigFloat.hpp"
+#include "NumberTheory.hpp"
+#include <algorithm>
+#include <sstream>
+
+namespace {
+    // the leaves of the splitting are merged pairwise, P isn't needed for the last merge
+    SeriesSplit Split(size_t first, size_t last, const SeriesTerm& a, const SeriesTerm& p, const SeriesTerm& q, bool needP) {
+        if( last - first == 1u ) {
+            auto P { p(first) };
+            auto T { a(first) * P };
+            return { std::move(P), q(first), std::move(T) };
+        }
+        const auto middle { first + (last - first) / 2 };
+        auto left { Split(first, middle, a, p, q, true) };
+        auto right { Split(middle, last, a, p, q, needP) };
+        SeriesSplit result;
+        result.T = left.T * right.Q;
+        AddMultiply(result.T, left.P, right.T);
+        result.Q = left.Q * right.Q;
+        if( needP ) {
+            result.P = left.P * right.P;
+        }
+        return result;
+    }
+}
+
+BigFloat::BigFloat(BigInt mantissa, std::int64_t exponent, size_t precision) :
+    m_mantissa { std::move(mantissa) },
+    m_exponent { exponent },
+    m_precision { precision }
+{
+    if( !m_precision ) {
+        throw std::domain_error("BigFloat: zero precision");
+    }
+    this->Normalize();
+}
+
+size_t BigFloat::PrecisionForDigits(size_t digits) noexcept {
+    // the highest coefficient may hold a single digit
+    return (digits + BigInt::DIGIT_COUNT - 1) / BigInt::DIGIT_COUNT + 1;
+}
+
+void BigFloat::SetPrecision(size_t precision) {
+    if( !precision ) {
+        throw std::domain_error("BigFloat: zero precision");
+    }
+    m_precision = precision;
+    this->Normalize();
+}
+
+void BigFloat::operator += (const BigFloat& rhs) {
+    m_precision = std::max(m_precision, rhs.m_precision);
+    if( rhs.IsZero() ) {
+        this->Normalize();
+        return;
+    }
+    if( this->IsZero() ) {
+        m_mantissa = rhs.m_mantissa;
+        m_exponent = rhs.m_exponent;
+        this->Normalize();
+        return;
+    }
+    // one guard coefficient is kept below the precision, the lower ones are truncated
+    const auto top { std::max(this->Top(), rhs.Top()) };
+    const auto low { std::max(std::min(m_exponent, rhs.m_exponent), top - static_cast<std::int64_t>(m_precision) - 1) };
+    const auto addend { Shifted(rhs.m_mantissa, rhs.m_exponent - low) };
+    m_mantissa = Shifted(m_mantissa, m_exponent - low);
+    m_mantissa += addend;
+    m_exponent = low;
+    this->Normalize();
+}
+
+void BigFloat::operator -= (const BigFloat& rhs) {
+    auto negated { rhs };
+    if( !negated.IsZero() ) {
+        -negated.m_mantissa;
+    }
+    *this += negated;
+}
+
+void BigFloat::operator *= (const BigFloat& rhs) {
+    m_precision = std::max(m_precision, rhs.m_precision);
+    m_mantissa *= rhs.m_mantissa;
+    m_exponent += rhs.m_exponent;
+    this->Normalize();
+}
+
+void BigFloat::operator /= (const BigFloat& rhs) {
+    const auto precision { std::max(m_precision, rhs.m_precision) };
+    // one more coefficient for the error of the reciprocal
+    auto inverse { rhs };
+    inverse.m_precision = precision + 1;
+    m_precision = precision + 1;
+    *this *= Reciprocal(inverse);
+    this->SetPrecision(precision);
+}
+
+void BigFloat::Normalize() {
+    auto& coefficients { m_mantissa.m_coefficients };
+    if( m_mantissa.IsZero() ) {
+        m_mantissa.m_isPositive = true;
+        m_exponent = 0;
+        return;
+    }
+    if( coefficients.size() > m_precision ) {
+        const auto excess { coefficients.size() - m_precision };
+        coefficients.erase(coefficients.begin(), coefficients.begin() + excess);
+        m_exponent += static_cast<std::int64_t>(excess);
+    }
+    const auto zeros { std::find_if(coefficients.cbegin(), coefficients.cend(), [](auto c) { return c != 0; }) - coefficients.cbegin() };
+    coefficients.erase(coefficients.begin(), coefficients.begin() + zeros);
+    m_exponent += zeros;
+}
+
+BigInt BigFloat::Shifted(const BigInt& value, std::int64_t shift) {
+    if( shift >= 0 ) {
+        return value.ShiftLeft(static_cast<size_t>(shift));
+    }
+    auto shifted { value.ShiftRight(static_cast<size_t>(-shift)) };
+    shifted.m_isPositive = shifted.m_isPositive || shifted.IsZero();
+    return shifted;
+}
+
+BigFloat operator+ (const BigFloat& lhs, const BigFloat& rhs) {
+    auto x { lhs };
+    x += rhs;
+    return x;
+}
+
+BigFloat operator- (const BigFloat& lhs, const BigFloat& rhs) {
+    auto x { lhs };
+    x -= rhs;
+    return x;
+}
+
+BigFloat operator* (const BigFloat& lhs, const BigFloat& rhs) {
+    auto x { lhs };
+    x *= rhs;
+    return x;
+}
+
+BigFloat operator/ (const BigFloat& lhs, const BigFloat& rhs) {
+    auto x { lhs };
+    x /= rhs;
+    return x;
+}
+
+bool operator== (const BigFloat& lhs, const BigFloat& rhs) {
+    return lhs.m_exponent == rhs.m_exponent && lhs.m_mantissa == rhs.m_mantissa;
+}
+
+bool operator!= (const BigFloat& lhs, const BigFloat& rhs) {
+    return !(lhs == rhs);
+}
+
+BigFloat Reciprocal(const BigFloat& x) {
+    return BigFloat::ReciprocalOf(x);
+}
+
+BigFloat InverseSqrt(const BigFloat& x) {
+    return BigFloat::InverseSqrtOf(x);
+}
+
+BigFloat BigFloat::ReciprocalOf(const BigFloat& x) {
+    if( x.IsZero() ) {
+        throw std::domain_error("BigFloat: division by zero");
+    }
+    // x = divisor * RADIX^(exponent + size - n), the divisor has exactly n coefficients
+    const auto n { static_cast<std::int64_t>(x.m_precision) + 1 };
+    const auto size { static_cast<std::int64_t>(x.m_mantissa.m_coefficients.size()) };
+    auto divisor { Shifted(x.m_mantissa, n - size) };
+    divisor.m_isPositive = true;
+    // 1 / x = floor(RADIX^(2n) / divisor) * RADIX^(-2n - exponent - size + n)
+    auto inverse { BigInt::Reciprocal(divisor) };
+    inverse.m_isPositive = x.IsPositive();
+    return BigFloat { std::move(inverse), -n - x.m_exponent - size, x.m_precision };
+}
+
+BigFloat BigFloat::InverseSqrtOf(const BigFloat& x) {
+    if( x.IsZero() || !x.IsPositive() ) {
+        throw std::domain_error("BigFloat: inverse square root of non-positive value");
+    }
+    const auto precision { x.m_precision };
+    if( precision <= INVERSE_SQRT_THRESHOLD ) {
+        // the mantissa is extended to 2 * precision + 2 coefficients and the exponent made even,
+        // so the integer root has precision + 1 coefficients
+        const auto size { static_cast<std::int64_t>(x.m_mantissa.m_coefficients.size()) };
+        auto shift { 2 * static_cast<std::int64_t>(precision) + 2 - size };
+        if( (x.m_exponent - shift) % 2 ) {
+            shift++;
+        }
+        auto root { IntegerSqrt(Shifted(x.m_mantissa, shift)) };
+        auto y { ReciprocalOf(BigFloat { std::move(root), (x.m_exponent - shift) / 2, precision + 1 }) };
+        y.SetPrecision(precision);
+        return y;
+    }
+    // the root of the highest half is precise enough for one step
+    const auto half { precision / 2 + 2 };
+    auto truncated { x };
+    truncated.SetPrecision(half);
+    auto y { InverseSqrtOf(truncated) };
+    y.m_precision = precision + 2;
+
+    // 1 - x * y^2 is about RADIX^-half, so the correction needs half coefficients only
+    BigFloat error { BigInt{ 1 }, 0, precision + 2 };
+    error -= x * y * y;
+    error.SetPrecision(half);
+    auto correction { y };
+    correction.SetPrecision(half);
+    correction *= error;
+    correction *= BigFloat { BigInt{ BigInt::RADIX / 2 }, -1, half };
+    y += correction;
+    y.SetPrecision(precision);
+    return y;
+}
+
+BigFloat Sqrt(const BigFloat& x) {
+    if( !x.IsPositive() ) {
+        throw std::domain_error("BigFloat: square root of negative value");
+    }
+    if( x.IsZero() ) {
+        return x;
+    }
+    auto extended { x };
+    extended.SetPrecision(x.Precision() + 1);
+    auto root { extended * InverseSqrt(extended) };
+    root.SetPrecision(x.Precision());
+    return root;
+}
+
+std::ostream& operator<<(std::ostream& os, const BigFloat& x) {
+    x.Print(os);
+    return os;
+}
+
+void BigFloat::Print(std::ostream& os) const {
+    auto magnitude { m_mantissa };
+    magnitude.m_isPositive = true;
+    std::ostringstream mantissa;
+    mantissa << magnitude;
+    auto digits { mantissa.str() };
+    if( !this->IsPositive() ) {
+        os << '-';
+    }
+    if( m_exponent >= 0 ) {
+        os << digits << std::string(static_cast<size_t>(m_exponent) * BigInt::DIGIT_COUNT, '0');
+        return;
+    }
+    const auto fraction { static_cast<size_t>(-m_exponent) * BigInt::DIGIT_COUNT };
+    if( digits.size() <= fraction ) {
+        digits.insert(0, fraction + 1 - digits.size(), '0');
+    }
+    digits.insert(digits.size() - fraction, 1, '.');
+    // the lowest coefficient isn't zero, so the fraction has a non-zero digit
+    digits.erase(digits.find_last_not_of('0') + 1);
+    os << digits;
+}
+
+SeriesSplit SplitSeries(size_t first, size_t last, const SeriesTerm& a, const SeriesTerm& p, const SeriesTerm& q) {
+    if( first >= last ) {
+        throw std::domain_error("BigFloat: empty series");
+    }
+    return Split(first, last, a, p, q, true);
+}
+
+BigFloat SumSeries(size_t count, const SeriesTerm& a, const SeriesTerm& p, const SeriesTerm& q, size_t precision) {
+    if( !count ) {
+        throw std::domain_error("BigFloat: empty series");
+    }
+    const auto split { Split(0, count, a, p, q, false) };
+    return BigFloat { split.T, 0, precision } / BigFloat { split.Q, 0, precision };
+}
+
+BigFloat Pi(size_t precision) {
+    // pi = 426880 * sqrt(10005) / sum of (6k)! (13591409 + 545140134k) / ((3k)! (k!)^3 (-640320)^(3k))
+    const auto a = [](size_t k) {
+        return BigInt{ 13591409 } + BigInt{ 545140134 } * BigInt{ static_cast<long long>(k) };
+    };
+    // the factors are multiplied as BigInt: their product overflows 64 bits for k > 5 * 10^5
+    const auto p = [](size_t k) {
+        const auto n { static_cast<long long>(k) };
+        return k? BigInt{ 5 - 6 * n } * BigInt{ 2 * n - 1 } * BigInt{ 6 * n - 1 }: BigInt{ 1 };
+    };
+    const auto q = [](size_t k) {
+        const BigInt n { static_cast<long long>(k) };
+        // 640320^3 / 24
+        return k? n * n * n * BigInt{ 10939058860032000 }: BigInt{ 1 };
+    };
+    // 9 decimal digits per coefficient
+    const auto count { precision * 9 / 14 + 2 };
+    const auto split { Split(0, count, a, p, q, false) };
+    const auto extended { precision + 1 };
+    auto pi { BigFloat { BigInt{ 426880 }, 0, extended } * Sqrt(BigFloat { BigInt{ 10005 }, 0, extended }) };
+    pi *= BigFloat { split.Q, 0, extended };
+    pi /= BigFloat { split.T, 0, extended };
+    pi.SetPrecision(precision);
+    return pi;
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "BigInt.hpp"
+#include <cstdint>
+#include <functional>
+
+/**
+ * Floating-point number mantissa * RADIX^exponent (RADIX = 10^9), the mantissa
+ * keeps at most precision coefficients, i.e. 9 * precision decimal digits.
+ * Results are truncated toward zero to the largest precision of the operands
+ * (quotients and roots may be one unit of the last coefficient less),
+ * mantissa has no lowest zero coefficients, so equal values are represented equally.
+ */
+class BigFloat final {
+public:
+
+    // coefficients, i.e. 36 decimal digits
+    static constexpr size_t DEFAULT_PRECISION = 4;
+
+    /**
+     * Throws std::domain_error if precision is zero.
+     */
+    BigFloat(BigInt mantissa = BigInt{}, std::int64_t exponent = 0, size_t precision = DEFAULT_PRECISION);
+
+    /**
+     * Precision enough for the given number of significant decimal digits.
+     */
+    static size_t PrecisionForDigits(size_t digits) noexcept;
+
+    const BigInt& Mantissa() const noexcept {
+        return m_mantissa;
+    }
+
+    std::int64_t Exponent() const noexcept {
+        return m_exponent;
+    }
+
+    size_t Precision() const noexcept {
+        return m_precision;
+    }
+
+    /**
+     * Lower precision truncates the mantissa.
+     * Throws std::domain_error if precision is zero.
+     */
+    void SetPrecision(size_t precision);
+
+    bool IsPositive() const noexcept {
+        return m_mantissa.IsPositive();
+    }
+
+    bool IsZero() const noexcept {
+        return m_mantissa.IsZero();
+    }
+
+    void operator += (const BigFloat& rhs);
+    void operator -= (const BigFloat& rhs);
+    void operator *= (const BigFloat& rhs);
+
+    /**
+     * Multiplication by Reciprocal(rhs).
+     * Throws std::domain_error if rhs is zero.
+     */
+    void operator /= (const BigFloat& rhs);
+
+    friend bool operator== (const BigFloat& lhs, const BigFloat& rhs);
+
+    friend BigFloat Reciprocal(const BigFloat& x);
+    friend BigFloat InverseSqrt(const BigFloat& x);
+
+    friend std::ostream& operator<<(std::ostream& os, const BigFloat& x);
+
+private:
+
+    /**
+     * 1 / x: BigInt's Newton reciprocal of the highest precision + 1 coefficients.
+     */
+    static BigFloat ReciprocalOf(const BigFloat& x);
+
+    /**
+     * 1 / sqrt(x): Newton's iteration y += y * (1 - x * y^2) / 2,
+     * precision doubles on each level of recursion, no divisions except the lowest level.
+     */
+    static BigFloat InverseSqrtOf(const BigFloat& x);
+
+    void Print(std::ostream& os) const;
+
+    /**
+     * Truncates the mantissa to precision and moves its lowest zero coefficients to the exponent.
+     */
+    void Normalize();
+
+    /**
+     * Exponent of the coefficient right above the highest one.
+     */
+    std::int64_t Top() const noexcept {
+        return m_exponent + static_cast<std::int64_t>(m_mantissa.m_coefficients.size());
+    }
+
+    /**
+     * value * RADIX^shift, truncated toward zero if shift is negative. value isn't zero.
+     */
+    static BigInt Shifted(const BigInt& value, std::int64_t shift);
+
+    // precision up to which InverseSqrt is computed by IntegerSqrt
+    static constexpr size_t INVERSE_SQRT_THRESHOLD = 16;
+
+    BigInt m_mantissa;
+    std::int64_t m_exponent;
+    size_t m_precision;
+};
+
+BigFloat operator+ (const BigFloat& lhs, const BigFloat& rhs);
+BigFloat operator- (const BigFloat& lhs, const BigFloat& rhs);
+BigFloat operator* (const BigFloat& lhs, const BigFloat& rhs);
+BigFloat operator/ (const BigFloat& lhs, const BigFloat& rhs);
+
+bool operator== (const BigFloat& lhs, const BigFloat& rhs);
+bool operator!= (const BigFloat& lhs, const BigFloat& rhs);
+
+/**
+ * Throws std::domain_error if x is zero.
+ */
+BigFloat Reciprocal(const BigFloat& x);
+
+/**
+ * Throws std::domain_error if x isn't positive.
+ */
+BigFloat InverseSqrt(const BigFloat& x);
+
+/**
+ * x * InverseSqrt(x). Throws std::domain_error if x is negative.
+ */
+BigFloat Sqrt(const BigFloat& x);
+
+/**
+ * Exact decimal value in fixed-point notation, e.g. "-3.25" or "1000".
+ */
+std::ostream& operator<<(std::ostream& os, const BigFloat& x);
+
+/**
+ * Products P = p(first) * ... * p(last - 1), Q = q(first) * ... * q(last - 1) and the sum
+ * T = sum of a(k) * p(first) * ... * p(k) * q(k + 1) * ... * q(last - 1), k = first..last-1,
+ * so T / Q = sum of a(k) * p(first) * ... * p(k) / (q(first) * ... * q(k)).
+ */
+struct SeriesSplit {
+    BigInt P;
+    BigInt Q;
+    BigInt T;
+};
+
+using SeriesTerm = std::function<BigInt(size_t)>;
+
+/**
+ * Binary splitting of hypergeometric series over [first, last):
+ * halves are computed recursively and merged by
+ * P = P1 * P2, Q = Q1 * Q2, T = T1 * Q2 + P1 * T2,
+ * so the operands of each level are balanced and the multiplications of the upper levels
+ * are done by the subquadratic algorithms. O(M(n) log(n)) for n-coefficient result.
+ * Throws std::domain_error if first >= last.
+ */
+SeriesSplit SplitSeries(size_t first, size_t last, const SeriesTerm& a, const SeriesTerm& p, const SeriesTerm& q);
+
+/**
+ * Sum of a(k) * p(0) * ... * p(k) / (q(0) * ... * q(k)), k = 0..count-1, with the given precision.
+ * Throws std::domain_error if count is zero.
+ */
+BigFloat SumSeries(size_t count, const SeriesTerm& a, const SeriesTerm& p, const SeriesTerm& q, size_t precision);
+
+/**
+ * Pi by the Chudnovsky series summed by SplitSeries, about 14 digits per term.
+ */
+BigFloat Pi(size_t precision);
@@ -0,0 +1,410 @@
+#include "BigInt.hpp"
+#include "Async.hpp"
+
+BigInt PositiveKaratsubaMultiplication(const BigInt& lhs, const BigInt& rhs) {
+    BigInt result;
+    if( BigInt::IsCheckpointed(lhs, rhs) ) {
+        result = BigInt::SplitMultiplication(lhs, rhs);
+    }
+    else {
+        // limbs::Multiply expects the longer operand first
+        const auto& longer { lhs.m_coefficients.size() < rhs.m_coefficients.size()? rhs.m_coefficients: lhs.m_coefficients };
+        const auto& shorter { lhs.m_coefficients.size() < rhs.m_coefficients.size()? lhs.m_coefficients: rhs.m_coefficients };
+        result.m_coefficients.resize(longer.size() + shorter.size());
+        std::vector<int> scratch (limbs::MultiplyScratchSize(longer.size(), shorter.size()));
+        limbs::Multiply(result.m_coefficients.data(), longer.data(), longer.size(), shorter.data(), shorter.size(), scratch.data());
+        result.m_coefficients.resize(std::max<size_t>(limbs::Normalize(result.m_coefficients.data(), result.m_coefficients.size()), 1u));
+    }
+#ifdef BIGINT_VERIFY
+    BigInt::VerifyProduct(result, lhs, rhs);
+#endif
+    return result;
+}
+
+BigInt KaratsubaMultiplication(const BigInt& lhs, const BigInt& rhs) { 
+    BigInt result = PositiveKaratsubaMultiplication(lhs, rhs);
+    result.m_isPositive = rhs.m_isPositive == lhs.m_isPositive || result.IsZero();
+    return result;
+}
+
+void Multiply(BigInt& out, const BigInt& lhs, const BigInt& rhs) {
+    const bool isPositive { lhs.m_isPositive == rhs.m_isPositive };
+    if( std::min(lhs.m_coefficients.size(), rhs.m_coefficients.size()) > BigInt::KARATSUBA_THRESHOLD
+        || BigInt::IsCheckpointed(lhs, rhs)
+    ) {
+        out.m_coefficients = PositiveKaratsubaMultiplication(lhs, rhs).m_coefficients;
+    }
+    else if( &out == &lhs || &out == &rhs ) {
+        // the buffer keeps the previous coefficients of out, so neither of them is reallocated
+        thread_local std::vector<int> product;
+        BigInt::MultiplyCoefficients(lhs.m_coefficients, rhs.m_coefficients, product);
+        out.m_coefficients.swap(product);
+    }
+    else {
+        BigInt::MultiplyCoefficients(lhs.m_coefficients, rhs.m_coefficients, out.m_coefficients);
+    }
+    out.m_isPositive = isPositive || out.IsZero();
+}
+
+void AddMultiply(BigInt& accumulator, const BigInt& lhs, const BigInt& rhs) {
+    BigInt::AddProduct(accumulator, lhs, rhs, lhs.m_isPositive == rhs.m_isPositive);
+}
+
+void SubstractMultiply(BigInt& accumulator, const BigInt& lhs, const BigInt& rhs) {
+    BigInt::AddProduct(accumulator, lhs, rhs, lhs.m_isPositive != rhs.m_isPositive);
+}
+
+void BigInt::AddProduct(BigInt& accumulator, const BigInt& lhs, const BigInt& rhs, bool isPositive) {
+    if( std::min(lhs.m_coefficients.size(), rhs.m_coefficients.size()) > KARATSUBA_THRESHOLD
+        || BigInt::IsCheckpointed(lhs, rhs)
+    ) {
+        accumulator.AddMagnitude(PositiveKaratsubaMultiplication(lhs, rhs).m_coefficients, isPositive);
+    }
+    else if( accumulator.m_isPositive == isPositive && &accumulator != &lhs && &accumulator != &rhs ) {
+        BigInt::AddMultiplyCoefficients(accumulator.m_coefficients, lhs.m_coefficients, rhs.m_coefficients);
+    }
+    else {
+        thread_local std::vector<int> product;
+        BigInt::MultiplyCoefficients(lhs.m_coefficients, rhs.m_coefficients, product);
+        accumulator.AddMagnitude(product, isPositive);
+    }
+}
+
+void BigInt::MultiplyCoefficients(const std::vector<int>& lhs, const std::vector<int>& rhs, std::vector<int>& result) {
+    assert(&result != &lhs && &result != &rhs);
+    result.resize(lhs.size() + rhs.size());
+    limbs::MultiplyBasecase(result.data(), lhs.data(), lhs.size(), rhs.data(), rhs.size());
+    while(result.size() > 1u && !result.back()) {
+        result.pop_back();
+    }
+}
+
+void BigInt::AddMultiplyCoefficients(std::vector<int>& lhs, const std::vector<int>& lhsFactor, const std::vector<int>& rhsFactor) {
+    assert(&lhs != &lhsFactor && &lhs != &rhsFactor);
+    lhs.resize(std::max(lhs.size(), lhsFactor.size() + rhsFactor.size()) + 1u, 0);
+    for(size_t i = 0; i < rhsFactor.size(); i++) {
+        const auto carry { limbs::AddMultiplyBySmall(lhs.data() + i, lhsFactor.data(), lhsFactor.size(), rhsFactor[i]) };
+        const auto high { i + lhsFactor.size() };
+        limbs::Add(lhs.data() + high, lhs.data() + high, lhs.size() - high, &carry, 1);
+    }
+    while(lhs.size() > 1u && !lhs.back()) {
+        lhs.pop_back();
+    }
+}
+
+bool BigInt::SubstractCoefficients(std::vector<int>& lhs, const std::vector<int>& rhs) {
+    bool isLess { lhs.size() < rhs.size() };
+    if( lhs.size() == rhs.size() ) {
+        auto i { lhs.size() };
+        while( i-- > 0 && lhs[i] == rhs[i] );
+        isLess = i < lhs.size() && lhs[i] < rhs[i];
+    }
+    // the smaller one is substracted from the greater one
+    if( isLess ) {
+        lhs.resize(rhs.size(), 0);
+    }
+    int borrow { 0 };
+    for(size_t i = 0; i < lhs.size() && (i < rhs.size() || borrow); i++) {
+        const auto right { i < rhs.size()? rhs[i]: 0 };
+        lhs[i] = isLess? right - lhs[i] - borrow: lhs[i] - right - borrow;
+        borrow = lhs[i] < 0;
+        if( borrow ) lhs[i] += RADIX;
+    }
+    while(lhs.size() > 1u && !lhs.back()) {
+        lhs.pop_back();
+    }
+    return !isLess;
+}
+
+void BigInt::AddMagnitude(const std::vector<int>& product, bool isPositive) {
+    if( m_isPositive == isPositive ) {
+        m_coefficients.resize(std::max(m_coefficients.size(), product.size()) + 1u, 0);
+        int carry { 0 };
+        for(size_t i = 0; i < m_coefficients.size() && (i < product.size() || carry); i++) {
+            m_coefficients[i] += carry + (i < product.size()? product[i]: 0);
+            carry = m_coefficients[i] >= RADIX;
+            if( carry ) m_coefficients[i] -= RADIX;
+        }
+        while(m_coefficients.size() > 1u && !m_coefficients.back()) {
+            m_coefficients.pop_back();
+        }
+    }
+    else if( !BigInt::SubstractCoefficients(m_coefficients, product) ) {
+        m_isPositive = isPositive;
+    }
+    if( this->IsZero() ) {
+        m_isPositive = true;
+    }
+}
+
+std::pair<BigInt, BigInt> BigInt::DivModKnuth(const BigInt& rhs) const {
+    BigInt div, mod;
+    const auto n { rhs.m_coefficients.size() };
+    const auto m { m_coefficients.size() - n };
+    // normalize: scale both operands so the highest divisor's coefficient >= RADIX / 2
+    const auto factor { static_cast<int>(RADIX / (rhs.m_coefficients.back() + 1LL)) };
+    std::vector<int> u (m_coefficients.size() + 1, 0), v (n, 0);
+    u.back() = limbs::MultiplyBySmall(u.data(), m_coefficients.data(), m_coefficients.size(), factor);
+    const auto carry { limbs::MultiplyBySmall(v.data(), rhs.m_coefficients.data(), n, factor) };
+    assert(!carry);
+    (void)carry;
+
+    div.m_coefficients.assign(m + 1, 0);
+    // a step of progress is a block of quotient's coefficients, about CHECKPOINT_WORK coefficient pairs
+    const auto block { std::max<size_t>(CHECKPOINT_WORK / n, 1) };
+    ProgressScope progress { (m + block) / block };
+    for(size_t j = m + 1; j-- > 0; ) {
+        // estimate quotient's coefficient by two highest coefficients
+        const auto top { 1LL * u[j + n] * RADIX + u[j + n - 1] };
+        auto qhat { top / v[n - 1] };
+        auto rhat { top % v[n - 1] };
+        while( qhat >= RADIX || qhat * v[n - 2] > rhat * RADIX + u[j + n - 2] ) {
+            qhat--;
+            rhat += v[n - 1];
+            if( rhat >= RADIX ) break;
+        }
+        // multiply and substract: u[j..j+n] -= qhat * v
+        const auto borrow { limbs::SubstractMultiplyBySmall(u.data() + j, v.data(), n, static_cast<int>(qhat)) };
+        // qhat was one too large (rare): add divisor back
+        if( u[j + n] < borrow ) {
+            qhat--;
+            u[j + n] += limbs::Add(u.data() + j, u.data() + j, v.data(), n) - borrow;
+        }
+        else {
+            u[j + n] -= borrow;
+        }
+        div.m_coefficients[j] = static_cast<int>(qhat);
+        if( j % block == 0 ) {
+            progress.Step();
+        }
+    }
+    while(div.m_coefficients.size() > 1u && !div.m_coefficients.back()) {
+        div.m_coefficients.pop_back();
+    }
+    // unnormalize reminder
+    mod.m_coefficients.assign(u.cbegin(), u.cbegin() + n);
+    while(mod.m_coefficients.size() > 1u && !mod.m_coefficients.back()) {
+        mod.m_coefficients.pop_back();
+    }
+    mod.DivideBySmall(static_cast<std::uint32_t>(factor));
+    return {div, mod};
+}
+
+std::pair<BigInt, BigInt> BigInt::DivModNewton(const BigInt& rhs) const {
+    const auto n { rhs.m_coefficients.size() };
+    auto divisor { rhs };
+    divisor.m_isPositive = true;
+    const auto inverse { BigInt::Reciprocal(divisor) };
+
+    BigInt div, mod;
+    div.m_coefficients.assign(m_coefficients.size(), 0);
+    // long division by blocks of n coefficients: each partial dividend is less than
+    // divisor * RADIX^n, so its quotient fits into the block
+    const auto blocks { (m_coefficients.size() + n - 1) / n };
+    ProgressScope progress { blocks };
+    for(size_t block = blocks; block-- > 0; ) {
+        const auto first { m_coefficients.cbegin() + block * n };
+        const auto last { block + 1 == blocks? m_coefficients.cend(): first + n };
+        auto current { mod.ShiftLeft(n) };
+        std::copy(first, last, current.m_coefficients.begin());
+        while(current.m_coefficients.size() > 1u && !current.m_coefficients.back()) {
+            current.m_coefficients.pop_back();
+        }
+        // Barrett's estimate is at most two less than the exact quotient
+        auto quotient { PositiveKaratsubaMultiplication(current.ShiftRight(n - 1), inverse).ShiftRight(n + 1) };
+        mod = current - PositiveKaratsubaMultiplication(quotient, divisor);
+        while( mod.CompareMagnitude(divisor) >= 0 ) {
+            mod -= divisor;
+            quotient += BigInt{1};
+        }
+        std::copy(quotient.m_coefficients.cbegin(), quotient.m_coefficients.cend(), div.m_coefficients.begin() + block * n);
+        progress.Step();
+    }
+    while(div.m_coefficients.size() > 1u && !div.m_coefficients.back()) {
+        div.m_coefficients.pop_back();
+    }
+    return {div, mod};
+}
+
+bool BigInt::IsCheckpointed(const BigInt& lhs, const BigInt& rhs) noexcept {
+    return lhs.m_coefficients.size() * rhs.m_coefficients.size() > CHECKPOINT_WORK && OperationContext::Current();
+}
+
+BigInt BigInt::SplitMultiplication(const BigInt& lhs, const BigInt& rhs) {
+    const auto& longer { lhs.m_coefficients.size() < rhs.m_coefficients.size()? rhs: lhs };
+    const auto& shorter { lhs.m_coefficients.size() < rhs.m_coefficients.size()? lhs: rhs };
+    const auto n { longer.m_coefficients.size() };
+    const auto m { shorter.m_coefficients.size() };
+    const auto part = [](const BigInt& x, size_t first, size_t last) {
+        BigInt result;
+        result.m_coefficients.assign(x.m_coefficients.cbegin() + first, x.m_coefficients.cbegin() + last);
+        result.m_coefficients.resize(std::max<size_t>(limbs::Normalize(result.m_coefficients.data(), result.m_coefficients.size()), 1u));
+        return result;
+    };
+    BigInt product;
+    product.m_coefficients.assign(n + m, 0);
+    // partial sums don't exceed the product, so there is no carry out
+    const auto addAt = [&product](const BigInt& x, size_t offset) {
+        auto& coefficients { product.m_coefficients };
+        const auto carry { limbs::Add(coefficients.data() + offset, coefficients.data() + offset, coefficients.size() - offset,
+            x.m_coefficients.data(), x.m_coefficients.size()) };
+        assert(!carry);
+        (void)carry;
+    };
+
+    const auto h { (n + 1) / 2 };
+    if( m <= h ) {
+        // blocks of the longer operand, each product is about CHECKPOINT_WORK or balanced
+        const auto block { std::max(m, CHECKPOINT_WORK / m) };
+        ProgressScope progress { (n + block - 1) / block };
+        for(size_t first = 0; first < n; first += block) {
+            addAt(PositiveKaratsubaMultiplication(part(longer, first, std::min(first + block, n)), shorter), first);
+            progress.Step();
+        }
+    }
+    else {
+        // A = a1 * x + a0, B = b1 * x + b0, x = RADIX^h
+        ProgressScope progress { 3 };
+        auto a0 { part(longer, 0, h) };
+        auto b0 { part(shorter, 0, h) };
+        const auto a1 { part(longer, h, n) };
+        const auto b1 { part(shorter, h, m) };
+        const auto low { PositiveKaratsubaMultiplication(a0, b0) };
+        addAt(low, 0);
+        progress.Step();
+        const auto high { PositiveKaratsubaMultiplication(a1, b1) };
+        addAt(high, 2 * h);
+        progress.Step();
+        a0.AddPositiveInteger(a1);
+        b0.AddPositiveInteger(b1);
+        auto middle { PositiveKaratsubaMultiplication(a0, b0) };
+        middle -= low;
+        middle -= high;
+        addAt(middle, h);
+        progress.Step();
+    }
+    product.m_coefficients.resize(std::max<size_t>(limbs::Normalize(product.m_coefficients.data(), product.m_coefficients.size()), 1u));
+    return product;
+}
+
+BigInt BigInt::Reciprocal(const BigInt& divisor) {
+    const auto n { divisor.m_coefficients.size() };
+    BigInt power {};
+    power.m_coefficients.assign(2 * n + 1, 0);
+    power.m_coefficients.back() = 1;
+    if( n < NEWTON_RECIPROCAL_THRESHOLD ) {
+        return power.DivMod(divisor).first;
+    }
+    // the reciprocal y of the highest h = n / 2 + 2 coefficients is precise enough for one step,
+    // x = y * RADIX^(n - h) isn't formed before the step to keep operands short
+    const auto h { n / 2 + 2 };
+    const auto y { BigInt::Reciprocal(divisor.ShiftRight(n - h)) };
+    const auto error { power - PositiveKaratsubaMultiplication(divisor, y).ShiftLeft(n - h) };
+    // the lowest n - 2 coefficients of the error affect less than RADIX^-2 of the step
+    auto x { y.ShiftLeft(n - h) };
+    x += KaratsubaMultiplication(y, error.ShiftRight(n - 2)).ShiftRight(h + 2);
+    // x is off by a few units at most
+    auto reminder { power - PositiveKaratsubaMultiplication(divisor, x) };
+    while( !reminder.m_isPositive ) {
+        reminder += divisor;
+        x -= BigInt{1};
+    }
+    while( reminder.CompareMagnitude(divisor) >= 0 ) {
+        reminder -= divisor;
+        x += BigInt{1};
+    }
+    return x;
+}
+
+#ifdef BIGINT_VERIFY
+void BigInt::VerifyProduct(const BigInt& product, const BigInt& lhs, const BigInt& rhs) {
+    std::vector<int> expected;
+    BigInt::MultiplyCoefficients(lhs.m_coefficients, rhs.m_coefficients, expected);
+    if( product.m_coefficients != expected ) {
+        throw std::logic_error("BigInt: verification of KaratsubaMultiplication failed");
+    }
+}
+
+void BigInt::VerifyDivMod(const BigInt& rhs, const BigInt& div, const BigInt& mod) const {
+    // operands may have leading zero coefficients, so they are compared by differences
+    auto difference { div * rhs };
+    difference += mod;
+    difference -= *this;
+    auto reminder { mod };
+    reminder.m_isPositive = true;
+    auto divisor { rhs };
+    divisor.m_isPositive = true;
+    const bool isReduced { !(reminder - divisor).IsPositive() };
+    if( !difference.IsZero() || !isReduced || (!mod.IsZero() && mod.m_isPositive != m_isPositive) ) {
+        throw std::logic_error("BigInt: verification of DivMod failed");
+    }
+}
+#endif
+
+BigInt operator+ (const BigInt& lhs, const BigInt& rhs) {
+    auto x { lhs };
+    x += rhs;
+    return x;
+}
+
+BigInt operator- (const BigInt& lhs, const BigInt& rhs) {
+    auto x { lhs };
+    x -= rhs;
+    return x;
+}
+
+BigInt operator* (const BigInt& lhs, const BigInt& rhs) {
+    auto x { lhs };
+    x *= rhs;
+    return x;
+}
+
+BigInt operator/ (const BigInt& lhs, const BigInt& rhs) {
+    auto x { lhs };
+    x /= rhs;
+    return  x;
+}
+
+BigInt operator% (const BigInt& lhs, const BigInt& rhs) {
+    auto x { lhs };
+    x %= rhs;
+    return x;
+}
+
+int Compare(const BigInt& lhs, const BigInt& rhs) noexcept {
+    // positive always greater negative, zero is positive
+    if( lhs.m_isPositive != rhs.m_isPositive ) {
+        return lhs.m_isPositive? 1: -1;
+    }
+    const auto magnitude { lhs.CompareMagnitude(rhs) };
+    return lhs.m_isPositive? magnitude: -magnitude;
+}
+
+bool operator< (const BigInt& lhs, const BigInt& rhs) {
+    return Compare(lhs, rhs) < 0;
+}
+
+bool operator> (const BigInt& lhs, const BigInt& rhs) {
+    return Compare(lhs, rhs) > 0;
+}
+
+bool operator<= (const BigInt& lhs, const BigInt& rhs) {
+    return Compare(lhs, rhs) <= 0;
+}
+
+bool operator>= (const BigInt& lhs, const BigInt& rhs) {
+    return Compare(lhs, rhs) >= 0;
+}
+
+bool operator!= (const BigInt& lhs, const BigInt& rhs) {
+    return Compare(lhs, rhs) != 0;
+}
+
+bool operator== (const BigInt& lhs, const BigInt& rhs) {
+    return Compare(lhs, rhs) == 0;
+}
+
+std::ostream& operator<<(std::ostream& os, const BigInt& x) {
+    x.Print(os);
+    return os;
+}
@@ -7,11 +7,27 @@
 #include <cassert>
 #include <string_view>
 #include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <tuple>
+#include <functional>
+#include "Limbs.hpp"
 
 namespace helper {
     class Tests;
+    class NumberTheory;
+    class Primality;
+    class Parallel;
+    class Radix;
+    class Async;
 }
 
+class BigIntAccumulator;
+class BigRational;
+class BigFloat;
+class BigDecimal;
+
 class BigInt final {
 public:
 
@@ -25,6 +41,17 @@ public:
         }
     }
 
+    BigInt(long long number) :
+        m_isPositive { number >= 0 }
+    {
+        // negate through unsigned type so the LLONG_MIN doesn't overflow
+        auto magnitude { number < 0? 0ULL - static_cast<unsigned long long>(number): static_cast<unsigned long long>(number) };
+        do {
+            m_coefficients.push_back(static_cast<int>(magnitude % RADIX));
+            magnitude /= RADIX;
+        } while(magnitude);
+    }
+
     void operator-() noexcept {
         m_isPositive = static_cast<int>(m_isPositive) ^ 1;
     }
@@ -33,6 +60,10 @@ public:
         return m_isPositive;
     }
 
+    bool IsZero() const noexcept {
+        return m_coefficients.size() == 1u && !m_coefficients.front();
+    }
+
     void operator += (const BigInt& rhs) {
         if( m_isPositive && rhs.m_isPositive) {
             this->AddPositiveInteger(rhs);
@@ -93,23 +124,9 @@ public:
         }
     }
 
-    // Time compexity: O(n*n)
+    // Time complexity: O(n*m) below KARATSUBA_THRESHOLD, O(n^(1.585)) by Karatsuba above it
     void operator *= (const BigInt& rhs) {
-        std::vector<int> res (rhs.m_coefficients.size() + m_coefficients.size() + 1, 0U);
-        for(size_t i = 0; i < rhs.m_coefficients.size(); i++) {
-            for(size_t j = 0, carry = 0; j < m_coefficients.size() || carry; j++) {
-                const auto cur { 1ULL * rhs.m_coefficients[i] * (j < m_coefficients.size()? m_coefficients[j]: 0LL ) + carry + res[i + j] };
-                res[i + j] = cur % RADIX;
-                carry = cur / RADIX;
-            }
-        }
-        // remove leading zeroes
-        while(res.size() > 1 && !res.back()) {
-            res.pop_back();
-        }
-        // set up sign
-        m_isPositive = !static_cast<bool>(m_isPositive ^ rhs.m_isPositive);
-        m_coefficients = std::move(res);
+        Multiply(*this, *this, rhs);
     }
 
     void operator /= (const BigInt& rhs) {
@@ -121,9 +138,76 @@ public:
         *this = this->DivMod(rhs).second;
     }
 
+    /**
+     * *this *= 10^exponent: shift by exponent / DIGIT_COUNT coefficients
+     * and one multiplication by a single coefficient. O(n)
+     */
+    void ScaleByPow10(size_t exponent) {
+        if( this->IsZero() ) {
+            return;
+        }
+        if( const auto factor { POWERS_OF_TEN[exponent % DIGIT_COUNT] }; factor > 1 ) {
+            const auto carry { limbs::MultiplyBySmall(m_coefficients.data(), m_coefficients.data(), m_coefficients.size(), factor) };
+            if( carry ) {
+                m_coefficients.push_back(carry);
+            }
+        }
+        m_coefficients.insert(m_coefficients.begin(), exponent / DIGIT_COUNT, 0);
+    }
+
+    /**
+     * *this /= 10^exponent rounded toward zero like operator /=:
+     * shift by exponent / DIGIT_COUNT coefficients and one division by a single coefficient. O(n)
+     */
+    void TruncDivPow10(size_t exponent) {
+        const auto shift { exponent / DIGIT_COUNT };
+        if( shift >= m_coefficients.size() ) {
+            *this = BigInt{};
+            return;
+        }
+        m_coefficients.erase(m_coefficients.begin(), m_coefficients.begin() + shift);
+        this->DivideBySmall(static_cast<std::uint32_t>(POWERS_OF_TEN[exponent % DIGIT_COUNT]));
+        m_isPositive = m_isPositive || this->IsZero();
+    }
+
+    /**
+     * Number of decimal digits of the absolute value, 1 for zero. O(1)
+     */
+    size_t DigitCount() const noexcept {
+        auto count { (m_coefficients.size() - 1) * DIGIT_COUNT + 1 };
+        for(auto highest { m_coefficients.back() }; highest >= 10; highest /= 10) {
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     * Decimal digit of the absolute value at @position counting from the lowest one,
+     * zero for positions beyond DigitCount(). O(1)
+     */
+    int Digit(size_t position) const noexcept {
+        const auto index { position / DIGIT_COUNT };
+        if( index >= m_coefficients.size() ) {
+            return 0;
+        }
+        return m_coefficients[index] / POWERS_OF_TEN[position % DIGIT_COUNT] % 10;
+    }
+
+    /**
+     * Hash of the value consistent with operator==, see limbs::Hash.
+     */
+    size_t Hash() const noexcept {
+        const auto hash { limbs::Hash(m_coefficients.data(), m_coefficients.size()) };
+        return static_cast<size_t>(m_isPositive? hash: ~hash);
+    }
+
     // Time complexity: O(n^(1.585))
     friend BigInt PositiveKaratsubaMultiplication(const BigInt& lhs, const BigInt& rhs);
     friend BigInt KaratsubaMultiplication(const BigInt& lhs, const BigInt& rhs);
+
+    friend void Multiply(BigInt& out, const BigInt& lhs, const BigInt& rhs);
+    friend void AddMultiply(BigInt& accumulator, const BigInt& lhs, const BigInt& rhs);
+    friend void SubstractMultiply(BigInt& accumulator, const BigInt& lhs, const BigInt& rhs);
     
     friend BigInt operator+ (const BigInt& lhs, const BigInt& rhs);
     friend BigInt operator- (const BigInt& lhs, const BigInt& rhs);
@@ -131,10 +215,7 @@ public:
     friend BigInt operator/ (const BigInt& lhs, const BigInt& rhs);
     friend BigInt operator% (const BigInt& lhs, const BigInt& rhs);
 
-    friend bool operator<   (const BigInt& lhs, const BigInt& rhs);
-    friend bool operator>   (const BigInt& lhs, const BigInt& rhs);
-    friend bool operator!=  (const BigInt& lhs, const BigInt& rhs);
-    friend bool operator==  (const BigInt& lhs, const BigInt& rhs);
+    friend int Compare(const BigInt& lhs, const BigInt& rhs) noexcept;
 
     /// simple pod type as one operand
 
@@ -143,6 +224,15 @@ public:
 private:
 
     friend class helper::Tests;
+    friend class helper::NumberTheory;
+    friend class helper::Primality;
+    friend class helper::Parallel;
+    friend class helper::Radix;
+    friend class helper::Async;
+    friend class BigIntAccumulator;
+    friend class BigRational;
+    friend class BigFloat;
+    friend class BigDecimal;
 
     /**
      * Works like binary >> (just pop_front coefficient) 
@@ -201,16 +291,15 @@ private:
     ) {
         assert(m_isPositive && rhs.m_isPositive);
         
-        const auto size = std::max(m_coefficients.size(), rhs.m_coefficients.size());
-
-        auto carry { 0 };
-        for(size_t i = 0; i < size || carry; i++) {
-            if ( i == m_coefficients.size() ) { 
-                m_coefficients.push_back( 0 );
-            }
-            m_coefficients[i] += carry + (i < rhs.m_coefficients.size()? rhs.m_coefficients[i] : 0);
-            carry = m_coefficients[i] >= RADIX;
-            if( carry ) m_coefficients[i] -= RADIX;
+        if( m_coefficients.size() < rhs.m_coefficients.size() ) {
+            m_coefficients.resize(rhs.m_coefficients.size(), 0);
+        }
+        const auto carry { limbs::Add(
+            m_coefficients.data(), m_coefficients.data(), m_coefficients.size(), 
+            rhs.m_coefficients.data(), rhs.m_coefficients.size()
+        ) };
+        if( carry ) {
+            m_coefficients.push_back(carry);
         }
     }
 
@@ -227,18 +316,15 @@ private:
     void SubstractSmallerPositiveInteger(
         const BigInt& rhs
     ) {
-        assert(m_isPositive && rhs.m_isPositive && !(*this < rhs));
+        assert(m_isPositive && rhs.m_isPositive && this->CompareMagnitude(rhs) >= 0);
         
         // m_coefficients.size() >= rhs.m_coefficients.size() due to restrictions
-        for(size_t i = 0; i < m_coefficients.size(); i++) {
-            if( i < rhs.m_coefficients.size() ) {
-                m_coefficients[i] -= rhs.m_coefficients[i];
-            }
-            if ( m_coefficients[i] < 0) {
-                m_coefficients[i] += RADIX;
-                m_coefficients[i + 1]--;
-            }
-        }
+        const auto borrow { limbs::Substract(
+            m_coefficients.data(), m_coefficients.data(), m_coefficients.size(), 
+            rhs.m_coefficients.data(), rhs.m_coefficients.size()
+        ) };
+        assert(!borrow);
+        (void)borrow;
     }
 
     /** @brief
@@ -252,7 +338,7 @@ private:
     ) {
         assert(m_isPositive && rhs.m_isPositive);
         
-        if (!(*this < rhs)) {
+        if( this->CompareMagnitude(rhs) >= 0 ) {
             this->SubstractSmallerPositiveInteger(rhs);
         }
         else {
@@ -263,12 +349,150 @@ private:
         }
     }
 
+    /**
+     * School-like product of coefficients written into @result (reusing its capacity),
+     * @result must not be the same vector as an operand.
+     */
+    static void MultiplyCoefficients(const std::vector<int>& lhs, const std::vector<int>& rhs, std::vector<int>& result);
+
+    /**
+     * lhs += lhs' * rhs' in place, @lhs must not be the same vector as an operand.
+     */
+    static void AddMultiplyCoefficients(std::vector<int>& lhs, const std::vector<int>& lhsFactor, const std::vector<int>& rhsFactor);
+
+    /**
+     * lhs = |lhs - rhs| in place.
+     * Returns false if rhs is greater than lhs, i.e. the difference is negative.
+     */
+    static bool SubstractCoefficients(std::vector<int>& lhs, const std::vector<int>& rhs);
+
+    /**
+     * accumulator += sign * |lhs * rhs|, the sign is positive if @isPositive.
+     */
+    static void AddProduct(BigInt& accumulator, const BigInt& lhs, const BigInt& rhs, bool isPositive);
+
+    /**
+     * *this += sign * |product|, the sign is positive if @isPositive.
+     */
+    void AddMagnitude(const std::vector<int>& product, bool isPositive);
+
+    /**
+     * Compare absolute values of *this and rhs.
+     * Returns negative, zero or positive value like std::string::compare.
+     */
+    int CompareMagnitude(const BigInt& rhs) const noexcept {
+        const auto lSize { m_coefficients.size() };
+        const auto rSize { rhs.m_coefficients.size() };
+        if( lSize != rSize ) {
+            return lSize < rSize? -1: 1;
+        }
+        return limbs::Compare(m_coefficients.data(), rhs.m_coefficients.data(), lSize);
+    }
+
+    /** @brief
+     * Divide absolute value of caller object by @divisor. 
+     * @note 
+     * It will modify caller object, sign stays untouched.
+     * @return 
+     * reminder of the division (always non-negative)
+     */
+    std::uint32_t DivideBySmall(std::uint32_t divisor) {
+        const auto reminder { limbs::DivideBySmall(
+            m_coefficients.data(), m_coefficients.data(), m_coefficients.size(), divisor
+        ) };
+        while(m_coefficients.size() > 1u && !m_coefficients.back()) {
+            m_coefficients.pop_back();
+        }
+        return reminder;
+    }
+
+    /**
+     * Reminder of the division of absolute value by @divisor.
+     */
+    std::uint32_t RemainderBySmall(std::uint32_t divisor) const noexcept {
+        return limbs::RemainderBySmall(m_coefficients.data(), m_coefficients.size(), divisor);
+    }
+
+    /**
+     * Truncated division like for buildin integers:
+     * quotient is rounded toward zero, reminder has the sign of *this.
+     * Time complexity: O(n*m) by Knuth's Algorithm D for short divisors or quotients,
+     * O(M(n) * m / n) by Newton's reciprocal for long ones, M - cost of KaratsubaMultiplication.
+     */
     std::pair<BigInt, BigInt> DivMod(const BigInt& rhs) const {
+        if( rhs.IsZero() ) {
+            throw std::domain_error("BigInt: division by zero");
+        }
         BigInt div, mod;
-        
+
+        if( rhs.m_coefficients.size() == 1u ) {
+            div = *this;
+            mod = BigInt { div.DivideBySmall(rhs.m_coefficients.front()) };
+        }
+        else if( this->CompareMagnitude(rhs) < 0 ) {
+            mod = *this;
+        }
+        else if( rhs.m_coefficients.size() >= NEWTON_DIVISION_THRESHOLD 
+            && m_coefficients.size() - rhs.m_coefficients.size() >= NEWTON_DIVISION_THRESHOLD 
+        ) {
+            std::tie(div, mod) = this->DivModNewton(rhs);
+        }
+        else {
+            std::tie(div, mod) = this->DivModKnuth(rhs);
+        }
+        div.m_isPositive = m_isPositive == rhs.m_isPositive || div.IsZero();
+        mod.m_isPositive = m_isPositive || mod.IsZero();
+#ifdef BIGINT_VERIFY
+        this->VerifyDivMod(rhs, div, mod);
+#endif
         return {div, mod};
     }
 
+    /**
+     * Division of absolute values by Knuth's Algorithm D (TAOCP vol.2, 4.3.1),
+     * requires |*this| >= |rhs| and rhs to have at least two coefficients.
+     */
+    std::pair<BigInt, BigInt> DivModKnuth(const BigInt& rhs) const;
+
+    /**
+     * Division of absolute values: the quotient is computed by blocks of rhs' size
+     * as the product by Reciprocal(rhs) and corrected by a few substractions.
+     */
+    std::pair<BigInt, BigInt> DivModNewton(const BigInt& rhs) const;
+
+    /**
+     * floor(RADIX^(2n) / |divisor|), n - number of divisor's coefficients.
+     * Newton's iteration x += x * (RADIX^(2n) - divisor * x) / RADIX^(2n),
+     * precision doubles on each level of recursion.
+     */
+    static BigInt Reciprocal(const BigInt& divisor);
+
+    /**
+     * |lhs * rhs| by Karatsuba's step on BigInt level (by blocks for unbalanced operands),
+     * so an OperationContext is checked between the subproblems. See Async.hpp.
+     */
+    static BigInt SplitMultiplication(const BigInt& lhs, const BigInt& rhs);
+
+    /**
+     * Whether lhs * rhs is long enough to be split by SplitMultiplication:
+     * an OperationContext is running and the work (product of sizes) exceeds CHECKPOINT_WORK.
+     */
+    static bool IsCheckpointed(const BigInt& lhs, const BigInt& rhs) noexcept;
+
+#ifdef BIGINT_VERIFY
+    /**
+     * Cross-checks of the optimized tiers enabled by the BIGINT_VERIFY build option,
+     * a wrong result throws std::logic_error.
+     * The product is recomputed by the school-like algorithm, O(n*m).
+     */
+    static void VerifyProduct(const BigInt& product, const BigInt& lhs, const BigInt& rhs);
+
+    /**
+     * div * rhs + mod == *this, |mod| < |rhs| and mod has the sign of *this.
+     */
+    void VerifyDivMod(const BigInt& rhs, const BigInt& div, const BigInt& mod) const;
+#endif
+
     void ParseNonEmptyString(const std::string& number) {
         // TODO: add exceptons for parsing, e.g. if first char is letter etc.
         std::string_view sv { number };
@@ -313,7 +537,19 @@ private:
 private:
 
     static constexpr int DIGIT_COUNT = 9; // max number of digits in one cell
-    static constexpr int RADIX = 1'000'000'000;
+    static constexpr int RADIX = limbs::RADIX;
+    static constexpr int POWERS_OF_TEN[DIGIT_COUNT] = {
+        1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000
+    };
+    // operands with fewer coefficients are multiplied by the school-like algorithm
+    static constexpr size_t KARATSUBA_THRESHOLD = limbs::KARATSUBA_THRESHOLD;
+    // divisors and quotients with fewer coefficients are computed by Knuth's Algorithm D
+    static constexpr size_t NEWTON_DIVISION_THRESHOLD = 1024;
+    // reciprocals of shorter divisors are computed by Knuth's Algorithm D
+    static constexpr size_t NEWTON_RECIPROCAL_THRESHOLD = 256;
+    // products of more coefficient pairs are split by SplitMultiplication in an OperationContext,
+    // one such product takes a few milliseconds
+    static constexpr size_t CHECKPOINT_WORK = size_t{ 1 } << 24;
     
     // Contains coefficients; from left to right starting from 0..
     // N = m_coefficients[0] * RADIX ^ 0 + m_coefficients[1] * RADIX^1 + ... .
@@ -321,144 +557,53 @@ private:
     bool m_isPositive;
 };
 
-BigInt PositiveKaratsubaMultiplication(const BigInt& lhs, const BigInt& rhs) {
-    /**
-     * Algorithm is fairy simple:
-     * A = ax + b
-     * B = cx + d
-     * A * B = (ax + b)(cx + d) = acxx + x(ad + cb) + bd 
-     * AND
-     * (ad + cb) = (a + b)(c + d) - ac - bd
-     * SO
-     * A * B = ac * xx + x * ((a + b)(c + d) - ac - bd) + bd
-    */
-    auto degree = std::max(lhs.m_coefficients.size(), rhs.m_coefficients.size());
-    if(degree <= 1u) return lhs * rhs;
-
-    degree = (degree&1u) + (degree >> 1u);
-    // Split lhs and rhs into 2 equal parts:
-
-    // works like binary shift operator >> (pop_front coefficient)
-    auto a = lhs.ShiftRight(degree);
-    // cut off rank from right to left (from highest to lowest) (pop_back coefficients)
-    // min(size(), size() - degree)
-    auto b = lhs.CutOffRank(lhs.m_coefficients.size() > degree? lhs.m_coefficients.size() - degree: 0u); 
-    // works like binary shift operator >>
-    auto c = rhs.ShiftRight(degree); 
-    // cut off rank from right to left (from highest to lowest)
-    auto d = rhs.CutOffRank(rhs.m_coefficients.size() > degree? rhs.m_coefficients.size() - degree: 0u); 
-
-    // Compute the subproblems:
-    auto ac = PositiveKaratsubaMultiplication(a, c);
-    auto bd = PositiveKaratsubaMultiplication(b, d);
-    auto abcd = PositiveKaratsubaMultiplication(a + b, c + d);
-    return (abcd - ac - bd).ShiftLeft(degree) + ac.ShiftLeft(degree << 1u) + bd; 
-}
-
-BigInt KaratsubaMultiplication(const BigInt& lhs, const BigInt& rhs) { 
-    BigInt result = PositiveKaratsubaMultiplication(lhs, rhs);
-    result.m_isPositive = rhs.m_isPositive == lhs.m_isPositive;
-    return result;
-}
-
-BigInt operator+ (const BigInt& lhs, const BigInt& rhs) {
-    auto x { lhs };
-    x += rhs;
-    return x;
-}
-
-BigInt operator- (const BigInt& lhs, const BigInt& rhs) {
-    auto x { lhs };
-    x -= rhs;
-    return x;
-}
-
-BigInt operator* (const BigInt& lhs, const BigInt& rhs) {
-    auto x { lhs };
-    x *= rhs;
-    return x;
-}
-
-BigInt operator/ (const BigInt& lhs, const BigInt& rhs) {
-    auto x { lhs };
-    x /= rhs;
-    return  x;
-}
-
-BigInt operator% (const BigInt& lhs, const BigInt& rhs) {
-    auto x { lhs };
-    x %= rhs;
-    return x;
-}
-
-bool operator< (const BigInt& lhs, const BigInt& rhs) {
-    bool isLesser { false };
-    // positive always greater negative
-    if ( lhs.m_isPositive && !rhs.m_isPositive ) {
-        return false;
-    }
-    else if ( !lhs.m_isPositive && rhs.m_isPositive ) {
-        return true;
-    }
-
-    // reacheable for only positive or negative integers
-    const auto lSize { static_cast<int>(lhs.m_coefficients.size()) };
-    const auto rSize { static_cast<int>(rhs.m_coefficients.size()) };
-    
-    // number with higher number of digits is greater
-    if ( lSize > rSize ) {
-        isLesser = (lhs.m_isPositive && rhs.m_isPositive)? false: true;
-    }
-    else if(lSize < rSize) {
-        isLesser = (lhs.m_isPositive && rhs.m_isPositive)? true: false;
-    }
-    else if ( lSize == rSize ) { 
-        isLesser = false; // assume that integers are equel by default
-        // Go from the highest digit number to lowest: 
-        for(int i = lSize - 1; i >= 0; i-- ) {
-            if( lhs.m_coefficients[i] > rhs.m_coefficients[i] ) {
-                isLesser = (lhs.m_isPositive && rhs.m_isPositive)? false: true;
-                break;
-            } 
-            else if( lhs.m_coefficients[i] < rhs.m_coefficients[i] ) {
-                isLesser = (lhs.m_isPositive && rhs.m_isPositive)? true: false;
-                break;
-            }
+BigInt PositiveKaratsubaMultiplication(const BigInt& lhs, const BigInt& rhs);
+BigInt KaratsubaMultiplication(const BigInt& lhs, const BigInt& rhs);
+
+/**
+ * out = lhs * rhs. The product is written into the storage of @out, so multiplying
+ * into the same object over and over doesn't allocate. @out may be an operand itself.
+ */
+void Multiply(BigInt& out, const BigInt& lhs, const BigInt& rhs);
+
+/**
+ * accumulator += lhs * rhs. When the signs allow, the product is accumulated right into
+ * the coefficients of @accumulator without a temporary. @accumulator may be an operand itself.
+ */
+void AddMultiply(BigInt& accumulator, const BigInt& lhs, const BigInt& rhs);
+
+/**
+ * accumulator -= lhs * rhs, see AddMultiply.
+ */
+void SubstractMultiply(BigInt& accumulator, const BigInt& lhs, const BigInt& rhs);
+
+BigInt operator+ (const BigInt& lhs, const BigInt& rhs);
+BigInt operator- (const BigInt& lhs, const BigInt& rhs);
+BigInt operator* (const BigInt& lhs, const BigInt& rhs);
+BigInt operator/ (const BigInt& lhs, const BigInt& rhs);
+BigInt operator% (const BigInt& lhs, const BigInt& rhs);
+
+/**
+ * Three-way comparison in a single pass: negative if lhs < rhs, zero if equal, positive otherwise.
+ * Signs are compared first, then sizes, then coefficients from the highest one.
+ * All relational operators are derived from it.
+ */
+int Compare(const BigInt& lhs, const BigInt& rhs) noexcept;
+
+bool operator<   (const BigInt& lhs, const BigInt& rhs);
+bool operator>   (const BigInt& lhs, const BigInt& rhs);
+bool operator<=  (const BigInt& lhs, const BigInt& rhs);
+bool operator>=  (const BigInt& lhs, const BigInt& rhs);
+bool operator!=  (const BigInt& lhs, const BigInt& rhs);
+bool operator==  (const BigInt& lhs, const BigInt& rhs);
+
+std::ostream& operator<<(std::ostream& os, const BigInt& x);
+
+namespace std {
+    template<>
+    struct hash<BigInt> {
+        size_t operator()(const BigInt& x) const noexcept {
+            return x.Hash();
         }
-    }
-    return isLesser;
-}
-
-bool operator> (const BigInt& lhs, const BigInt& rhs) {
-    return !(lhs < rhs) && lhs != rhs;
-}
-
-bool operator!= (const BigInt& lhs, const BigInt& rhs) {
-    return !(lhs == rhs);
-}
-
-bool operator== (const BigInt& lhs, const BigInt& rhs) {
-    bool isEquel { true };
-
-    const auto lSize { lhs.m_coefficients.size() };
-    const auto rSize { rhs.m_coefficients.size() };
-    
-    if( lhs.m_isPositive != rhs.m_isPositive ||
-        lSize != rSize 
-    ) {
-        isEquel = false;
-    }
-
-    for(size_t i = 0; i < lSize && isEquel; i++) {
-        if( lhs.m_coefficients[i] != rhs.m_coefficients[i] ) {
-            isEquel = false;
-        }
-    }
-
-    return isEquel;
-}
-
-std::ostream& operator<<(std::ostream& os, const BigInt& x) {
-    x.Print(os);
-    return os;
+    };
 }
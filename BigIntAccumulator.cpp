@@ -0,0 +1,62 @@
+#include "BigIntAccumulator.hpp"
+
+void BigIntAccumulator::Merge(const BigIntAccumulator& other) {
+    // both normalized sums count as one addition each
+    if( m_additions + other.m_additions + 1u > CAPACITY ) {
+        auto coefficients { other.m_coefficients };
+        Normalize(coefficients);
+        Normalize(m_coefficients);
+        m_additions = 0;
+        BigIntAccumulator normalized;
+        normalized.m_coefficients = std::move(coefficients);
+        this->Merge(normalized);
+        return;
+    }
+    if( m_coefficients.size() < other.m_coefficients.size() ) {
+        m_coefficients.resize(other.m_coefficients.size(), 0);
+    }
+    for(size_t i = 0; i < other.m_coefficients.size(); i++) {
+        m_coefficients[i] += other.m_coefficients[i];
+    }
+    m_additions += other.m_additions + 1u;
+}
+
+BigInt BigIntAccumulator::Value() const {
+    auto coefficients { m_coefficients };
+    Normalize(coefficients);
+    const bool isPositive { coefficients.empty() || coefficients.back() >= 0 };
+    if( !isPositive ) {
+        // the magnitude of negative sum
+        for(auto& coefficient: coefficients) {
+            coefficient = -coefficient;
+        }
+        Normalize(coefficients);
+    }
+    BigInt result;
+    if( !coefficients.empty() ) {
+        result.m_coefficients.assign(coefficients.cbegin(), coefficients.cend());
+        result.m_isPositive = isPositive;
+    }
+    return result;
+}
+
+void BigIntAccumulator::Normalize(std::vector<std::int64_t>& coefficients) {
+    std::int64_t carry { 0 };
+    for(auto& coefficient: coefficients) {
+        coefficient += carry;
+        // floor division, so the coefficient becomes non-negative
+        carry = coefficient / RADIX - (coefficient % RADIX < 0);
+        coefficient -= carry * RADIX;
+    }
+    while( carry <= -RADIX || carry >= RADIX ) {
+        const auto next { carry / RADIX - (carry % RADIX < 0) };
+        coefficients.push_back(carry - next * RADIX);
+        carry = next;
+    }
+    if( carry ) {
+        coefficients.push_back(carry);
+    }
+    while( !coefficients.empty() && !coefficients.back() ) {
+        coefficients.pop_back();
+    }
+}
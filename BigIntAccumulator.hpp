@@ -0,0 +1,81 @@
+#pragma once
+
+#include "BigInt.hpp"
+
+/**
+ * Sum of many BigInt values with deferred normalization.
+ * Coefficients are kept in wide signed form, so adding or substracting a value
+ * costs O(rhs' size) without carry propagation and trimming.
+ * Carries are propagated when the value is read (or when the headroom of
+ * the coefficients is used up, i.e. once in ~9 * 10^9 additions).
+ */
+class BigIntAccumulator final {
+public:
+
+    BigIntAccumulator() = default;
+
+    explicit BigIntAccumulator(const BigInt& value) {
+        *this += value;
+    }
+
+    void operator += (const BigInt& rhs) {
+        this->Add(rhs, rhs.m_isPositive);
+    }
+
+    void operator -= (const BigInt& rhs) {
+        this->Add(rhs, !rhs.m_isPositive);
+    }
+
+    /**
+     * Adds the sum of @other, e.g. to combine per-thread accumulators.
+     */
+    void Merge(const BigIntAccumulator& other);
+
+    /**
+     * The normalized sum, the accumulator itself isn't changed.
+     */
+    BigInt Value() const;
+
+    void Clear() noexcept {
+        m_coefficients.clear();
+        m_additions = 0;
+    }
+
+private:
+
+    void Add(const BigInt& rhs, bool isPositive) {
+        if( m_additions == CAPACITY ) {
+            Normalize(m_coefficients);
+            m_additions = 0;
+        }
+        if( m_coefficients.size() < rhs.m_coefficients.size() ) {
+            m_coefficients.resize(rhs.m_coefficients.size(), 0);
+        }
+        if( isPositive ) {
+            for(size_t i = 0; i < rhs.m_coefficients.size(); i++) {
+                m_coefficients[i] += rhs.m_coefficients[i];
+            }
+        }
+        else {
+            for(size_t i = 0; i < rhs.m_coefficients.size(); i++) {
+                m_coefficients[i] -= rhs.m_coefficients[i];
+            }
+        }
+        m_additions++;
+    }
+
+    /**
+     * Propagates carries: all coefficients except the highest one become [0, RADIX),
+     * the highest one keeps the sign of the sum, |highest| < RADIX.
+     */
+    static void Normalize(std::vector<std::int64_t>& coefficients);
+
+    static constexpr std::int64_t RADIX = 1'000'000'000;
+    // each addition changes a coefficient by less than RADIX,
+    // normalized coefficients are less than RADIX by absolute value
+    static constexpr std::uint64_t CAPACITY = INT64_MAX / RADIX - 1;
+
+    std::vector<std::int64_t> m_coefficients;
+    // additions since the last normalization
+    std::uint64_t m_additions { 0 };
+};
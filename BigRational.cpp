@@ -0,0 +1,179 @@
+#include "BigRational.hpp"
+#include "NumberTheory.hpp"
+#include <numeric>
+
+BigRational::BigRational(BigInt numerator, BigInt denominator) :
+    m_numerator { std::move(numerator) },
+    m_denominator { std::move(denominator) }
+{
+    if( m_denominator.IsZero() ) {
+        throw std::domain_error("BigRational: zero denominator");
+    }
+    if( !m_denominator.IsPositive() ) {
+        -m_denominator;
+        if( !m_numerator.IsZero() ) {
+            -m_numerator;
+        }
+    }
+    this->ReduceLazily();
+}
+
+void BigRational::Reduce() {
+    const auto gcd { Gcd(m_numerator, m_denominator) };
+    if( gcd != BigInt{ 1 } ) {
+        m_numerator /= gcd;
+        m_denominator /= gcd;
+    }
+    m_reducedSize = m_denominator.m_coefficients.size();
+}
+
+void BigRational::Add(const BigRational& rhs, bool isAddition) {
+    const auto accumulate { isAddition? AddMultiply: SubstractMultiply };
+    if( rhs.IsInteger() ) {
+        // gcd(a + c * b, b) = gcd(a, b): the fraction stays as reduced as it was
+        accumulate(m_numerator, rhs.m_numerator, m_denominator);
+        return;
+    }
+    if( this->IsInteger() ) {
+        // a + c / d = (a * d + c) / d, reduced as much as c / d
+        auto numerator { rhs.m_numerator };
+        if( !isAddition ) {
+            -numerator;
+        }
+        AddMultiply(numerator, m_numerator, rhs.m_denominator);
+        m_numerator = std::move(numerator);
+        m_denominator = rhs.m_denominator;
+        m_reducedSize = rhs.m_reducedSize;
+        return;
+    }
+    if( m_denominator == rhs.m_denominator ) {
+        if( isAddition ) {
+            m_numerator += rhs.m_numerator;
+        }
+        else {
+            m_numerator -= rhs.m_numerator;
+        }
+    }
+    else {
+        // a / b + c / d = (a * d + c * b) / (b * d)
+        auto numerator { m_numerator * rhs.m_denominator };
+        accumulate(numerator, rhs.m_numerator, m_denominator);
+        m_numerator = std::move(numerator);
+        m_denominator *= rhs.m_denominator;
+    }
+    this->ReduceLazily();
+}
+
+void BigRational::operator *= (const BigRational& rhs) {
+    const bool isInteger { rhs.IsInteger() };
+    m_numerator *= rhs.m_numerator;
+    if( !isInteger ) {
+        m_denominator *= rhs.m_denominator;
+    }
+    if( !isInteger || !this->IsInteger() ) {
+        this->ReduceLazily();
+    }
+}
+
+void BigRational::operator /= (const BigRational& rhs) {
+    if( rhs.m_numerator.IsZero() ) {
+        throw std::domain_error("BigRational: division by zero");
+    }
+    auto numerator { m_numerator * rhs.m_denominator };
+    auto denominator { m_denominator * rhs.m_numerator };
+    if( !denominator.IsPositive() ) {
+        -denominator;
+        if( !numerator.IsZero() ) {
+            -numerator;
+        }
+    }
+    m_numerator = std::move(numerator);
+    m_denominator = std::move(denominator);
+    this->ReduceLazily();
+}
+
+void BigRational::ReduceLazily() {
+    if( m_numerator.IsZero() ) {
+        m_denominator = BigInt{ 1 };
+        m_reducedSize = 1;
+        return;
+    }
+    // common powers of RADIX are common zero coefficients
+    size_t zeros { 0 };
+    while( !m_numerator.m_coefficients[zeros] && !m_denominator.m_coefficients[zeros] ) {
+        zeros++;
+    }
+    if( zeros ) {
+        m_numerator = m_numerator.ShiftRight(zeros);
+        m_denominator = m_denominator.ShiftRight(zeros);
+    }
+    // divisibility by divisors of RADIX depends on the lowest coefficients only
+    const auto commonDivisor = [this]() {
+        return std::gcd(std::gcd(m_numerator.m_coefficients.front(), m_denominator.m_coefficients.front()), BigInt::RADIX);
+    };
+    for(auto divisor { commonDivisor() }; divisor > 1; divisor = commonDivisor()) {
+        m_numerator.DivideBySmall(static_cast<std::uint32_t>(divisor));
+        m_denominator.DivideBySmall(static_cast<std::uint32_t>(divisor));
+    }
+    const auto size { m_denominator.m_coefficients.size() };
+    if( size >= REDUCTION_THRESHOLD && size > 2u * m_reducedSize ) {
+        this->Reduce();
+    }
+}
+
+BigRational operator+ (const BigRational& lhs, const BigRational& rhs) {
+    auto x { lhs };
+    x += rhs;
+    return x;
+}
+
+BigRational operator- (const BigRational& lhs, const BigRational& rhs) {
+    auto x { lhs };
+    x -= rhs;
+    return x;
+}
+
+BigRational operator* (const BigRational& lhs, const BigRational& rhs) {
+    auto x { lhs };
+    x *= rhs;
+    return x;
+}
+
+BigRational operator/ (const BigRational& lhs, const BigRational& rhs) {
+    auto x { lhs };
+    x /= rhs;
+    return x;
+}
+
+bool operator== (const BigRational& lhs, const BigRational& rhs) {
+    if( lhs.m_denominator == rhs.m_denominator ) {
+        return lhs.m_numerator == rhs.m_numerator;
+    }
+    // the fractions aren't necessarily reduced
+    return lhs.m_numerator * rhs.m_denominator == rhs.m_numerator * lhs.m_denominator;
+}
+
+bool operator!= (const BigRational& lhs, const BigRational& rhs) {
+    return !(lhs == rhs);
+}
+
+bool operator< (const BigRational& lhs, const BigRational& rhs) {
+    // sign of a * d - c * b, denominators are positive
+    auto difference { lhs.m_numerator * rhs.m_denominator };
+    SubstractMultiply(difference, rhs.m_numerator, lhs.m_denominator);
+    return !difference.IsPositive();
+}
+
+bool operator> (const BigRational& lhs, const BigRational& rhs) {
+    return rhs < lhs;
+}
+
+std::ostream& operator<<(std::ostream& os, const BigRational& x) {
+    auto reduced { x };
+    reduced.Reduce();
+    os << reduced.Numerator();
+    if( reduced.Denominator() != BigInt{ 1 } ) {
+        os << '/' << reduced.Denominator();
+    }
+    return os;
+}
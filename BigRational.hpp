@@ -0,0 +1,94 @@
+#pragma once
+
+#include "BigInt.hpp"
+
+/**
+ * Rational number numerator / denominator, the denominator is positive.
+ * Reduction is lazy: after each operation only cheap common factors are removed
+ * (common zero coefficients, i.e. powers of RADIX, and common divisors of RADIX
+ * found by the lowest coefficients), the full Gcd is computed once
+ * the denominator doubles in size since the last reduction.
+ * Operations with integer operands or equal denominators take fast paths.
+ */
+class BigRational final {
+public:
+
+    /**
+     * Throws std::domain_error if denominator is zero.
+     */
+    BigRational(BigInt numerator = BigInt{}, BigInt denominator = BigInt{ 1 });
+
+    /**
+     * Not necessarily in lowest terms unless Reduce() is called.
+     */
+    const BigInt& Numerator() const noexcept {
+        return m_numerator;
+    }
+
+    const BigInt& Denominator() const noexcept {
+        return m_denominator;
+    }
+
+    /**
+     * Brings the fraction to lowest terms.
+     */
+    void Reduce();
+
+    void operator += (const BigRational& rhs) {
+        this->Add(rhs, true);
+    }
+
+    void operator -= (const BigRational& rhs) {
+        this->Add(rhs, false);
+    }
+
+    void operator *= (const BigRational& rhs);
+
+    /**
+     * Throws std::domain_error if rhs is zero.
+     */
+    void operator /= (const BigRational& rhs);
+
+    friend bool operator== (const BigRational& lhs, const BigRational& rhs);
+    friend bool operator<  (const BigRational& lhs, const BigRational& rhs);
+
+private:
+
+    /**
+     * *this += rhs or *this -= rhs if !isAddition.
+     */
+    void Add(const BigRational& rhs, bool isAddition);
+
+    /**
+     * Removes cheap common factors and calls Reduce() when the denominator
+     * has grown twice since the last reduction.
+     */
+    void ReduceLazily();
+
+    bool IsInteger() const noexcept {
+        return m_denominator.m_coefficients.size() == 1u && m_denominator.m_coefficients.front() == 1;
+    }
+
+    // denominators with fewer coefficients aren't reduced by Gcd
+    static constexpr size_t REDUCTION_THRESHOLD = 8;
+
+    BigInt m_numerator;
+    BigInt m_denominator;
+    // size of denominator after the last full reduction
+    size_t m_reducedSize { 1 };
+};
+
+BigRational operator+ (const BigRational& lhs, const BigRational& rhs);
+BigRational operator- (const BigRational& lhs, const BigRational& rhs);
+BigRational operator* (const BigRational& lhs, const BigRational& rhs);
+BigRational operator/ (const BigRational& lhs, const BigRational& rhs);
+
+bool operator== (const BigRational& lhs, const BigRational& rhs);
+bool operator!= (const BigRational& lhs, const BigRational& rhs);
+bool operator<  (const BigRational& lhs, const BigRational& rhs);
+bool operator>  (const BigRational& lhs, const BigRational& rhs);
+
+/**
+ * Prints the fraction in lowest terms: "numerator/denominator" or just "numerator".
+ */
+std::ostream& operator<<(std::ostream& os, const BigRational& x);
@@ -0,0 +1,246 @@
+#include "Limbs.hpp"
+#include <algorithm>
+#include <cassert>
+
+namespace limbs {
+
+    Limb Add(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t n) noexcept {
+        Limb carry { 0 };
+        for(std::size_t i = 0; i < n; i++) {
+            const Limb sum { lhs[i] + rhs[i] + carry };
+            carry = sum >= RADIX;
+            result[i] = carry? sum - RADIX: sum;
+        }
+        return carry;
+    }
+
+    Limb Add(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize) noexcept {
+        assert(lhsSize >= rhsSize);
+        auto carry { Add(result, lhs, rhs, rhsSize) };
+        std::size_t i { rhsSize };
+        for(; i < lhsSize && carry; i++) {
+            carry = lhs[i] == RADIX - 1;
+            result[i] = carry? 0: lhs[i] + 1;
+        }
+        if( result != lhs ) {
+            std::copy(lhs + i, lhs + lhsSize, result + i);
+        }
+        return carry;
+    }
+
+    Limb Substract(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t n) noexcept {
+        Limb borrow { 0 };
+        for(std::size_t i = 0; i < n; i++) {
+            const Limb difference { lhs[i] - rhs[i] - borrow };
+            borrow = difference < 0;
+            result[i] = borrow? difference + RADIX: difference;
+        }
+        return borrow;
+    }
+
+    Limb Substract(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize) noexcept {
+        assert(lhsSize >= rhsSize);
+        auto borrow { Substract(result, lhs, rhs, rhsSize) };
+        std::size_t i { rhsSize };
+        for(; i < lhsSize && borrow; i++) {
+            borrow = lhs[i] == 0;
+            result[i] = borrow? RADIX - 1: lhs[i] - 1;
+        }
+        if( result != lhs ) {
+            std::copy(lhs + i, lhs + lhsSize, result + i);
+        }
+        return borrow;
+    }
+
+    Limb MultiplyBySmall(Limb* result, const Limb* lhs, std::size_t n, Limb factor) noexcept {
+        std::uint64_t carry { 0 };
+        for(std::size_t i = 0; i < n; i++) {
+            const auto cur { 1ULL * lhs[i] * factor + carry };
+            result[i] = static_cast<Limb>(cur % RADIX);
+            carry = cur / RADIX;
+        }
+        return static_cast<Limb>(carry);
+    }
+
+    Limb AddMultiplyBySmall(Limb* result, const Limb* lhs, std::size_t n, Limb factor) noexcept {
+        std::uint64_t carry { 0 };
+        for(std::size_t i = 0; i < n; i++) {
+            const auto cur { 1ULL * lhs[i] * factor + carry + result[i] };
+            result[i] = static_cast<Limb>(cur % RADIX);
+            carry = cur / RADIX;
+        }
+        return static_cast<Limb>(carry);
+    }
+
+    Limb SubstractMultiplyBySmall(Limb* result, const Limb* lhs, std::size_t n, Limb factor) noexcept {
+        // the carry of the product and the borrow of the difference are kept apart,
+        // so the dependency chain between iterations stays short
+        std::uint64_t carry { 0 };
+        Limb borrow { 0 };
+        for(std::size_t i = 0; i < n; i++) {
+            const auto product { 1ULL * lhs[i] * factor + carry };
+            carry = product / RADIX;
+            const auto difference { result[i] - static_cast<Limb>(product % RADIX) - borrow };
+            borrow = difference < 0;
+            result[i] = difference + borrow * RADIX;
+        }
+        return static_cast<Limb>(carry) + borrow;
+    }
+
+    void MultiplyBasecase(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize) noexcept {
+        assert(lhsSize && rhsSize);
+        result[lhsSize] = MultiplyBySmall(result, lhs, lhsSize, rhs[0]);
+        for(std::size_t i = 1; i < rhsSize; i++) {
+            result[i + lhsSize] = AddMultiplyBySmall(result + i, lhs, lhsSize, rhs[i]);
+        }
+    }
+
+    std::size_t KaratsubaScratchSize(std::size_t n) noexcept {
+        std::size_t size { 0 };
+        while( n > KARATSUBA_THRESHOLD ) {
+            // the sums (a + b), (c + d) and their product, the rest is for the recursion
+            const auto high { n - n / 2 };
+            size += 4 * (high + 1);
+            n = high + 1;
+        }
+        return size;
+    }
+
+    void MultiplyKaratsuba(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t n, Limb* scratch) noexcept {
+        if( n <= KARATSUBA_THRESHOLD ) {
+            MultiplyBasecase(result, lhs, n, rhs, n);
+            return;
+        }
+        const auto low { n / 2 };
+        const auto high { n - low };
+        // bd and ac are computed right in their places
+        MultiplyKaratsuba(result, lhs, rhs, low, scratch);
+        MultiplyKaratsuba(result + 2 * low, lhs + low, rhs + low, high, scratch);
+
+        const auto lhsSum { scratch };
+        const auto rhsSum { scratch + high + 1 };
+        const auto middle { scratch + 2 * (high + 1) };
+        lhsSum[high] = Add(lhsSum, lhs + low, high, lhs, low);
+        rhsSum[high] = Add(rhsSum, rhs + low, high, rhs, low);
+        MultiplyKaratsuba(middle, lhsSum, rhsSum, high + 1, scratch + 4 * (high + 1));
+        Substract(middle, middle, 2 * (high + 1), result, 2 * low);
+        Substract(middle, middle, 2 * (high + 1), result + 2 * low, 2 * high);
+        // ad + bc < 2 * x^2, so it fits into n + 1 limbs
+        const auto carry { Add(result + low, result + low, 2 * n - low, middle, n + 1) };
+        assert(!carry);
+        (void)carry;
+    }
+
+    std::size_t MultiplyScratchSize(std::size_t lhsSize, std::size_t rhsSize) noexcept {
+        assert(lhsSize >= rhsSize);
+        if( rhsSize <= KARATSUBA_THRESHOLD ) {
+            return 0;
+        }
+        if( lhsSize == rhsSize ) {
+            return KaratsubaScratchSize(rhsSize);
+        }
+        auto size { KaratsubaScratchSize(rhsSize) };
+        if( const auto rest { lhsSize % rhsSize }; rest ) {
+            size = std::max(size, MultiplyScratchSize(rhsSize, rest));
+        }
+        // and the product of a block
+        return 2 * rhsSize + size;
+    }
+
+    void Multiply(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize, Limb* scratch) noexcept {
+        assert(lhsSize >= rhsSize);
+        if( rhsSize <= KARATSUBA_THRESHOLD ) {
+            MultiplyBasecase(result, lhs, lhsSize, rhs, rhsSize);
+            return;
+        }
+        if( lhsSize == rhsSize ) {
+            MultiplyKaratsuba(result, lhs, rhs, rhsSize, scratch);
+            return;
+        }
+        // the first block's product is written right into the result,
+        // the next ones are added to the high part of the previous one
+        const auto block { scratch };
+        scratch += 2 * rhsSize;
+        MultiplyKaratsuba(result, lhs, rhs, rhsSize, scratch);
+        std::size_t offset { rhsSize };
+        for(; offset + rhsSize <= lhsSize; offset += rhsSize) {
+            MultiplyKaratsuba(block, lhs + offset, rhs, rhsSize, scratch);
+            const auto carry { Add(result + offset, result + offset, block, rhsSize) };
+            std::copy(block + rhsSize, block + 2 * rhsSize, result + offset + rhsSize);
+            Add(result + offset + rhsSize, result + offset + rhsSize, rhsSize, &carry, 1);
+        }
+        if( const auto rest { lhsSize - offset }; rest ) {
+            Multiply(block, rhs, rhsSize, lhs + offset, rest, scratch);
+            const auto carry { Add(result + offset, result + offset, block, rhsSize) };
+            std::copy(block + rhsSize, block + rhsSize + rest, result + offset + rhsSize);
+            Add(result + offset + rhsSize, result + offset + rhsSize, rest, &carry, 1);
+        }
+    }
+
+    int Compare(const Limb* lhs, const Limb* rhs, std::size_t n) noexcept {
+        for(std::size_t i = n; i-- > 0; ) {
+            if( lhs[i] != rhs[i] ) {
+                return lhs[i] < rhs[i]? -1: 1;
+            }
+        }
+        return 0;
+    }
+
+    std::uint32_t DivideBySmall(Limb* quotient, const Limb* lhs, std::size_t n, std::uint32_t divisor) noexcept {
+        assert(divisor);
+        // reminder < 2^32, so reminder * RADIX + limb fits into 64 bits
+        std::uint64_t reminder { 0 };
+        for(std::size_t i = n; i-- > 0; ) {
+            const auto cur { reminder * RADIX + lhs[i] };
+            quotient[i] = static_cast<Limb>(cur / divisor);
+            reminder = cur % divisor;
+        }
+        return static_cast<std::uint32_t>(reminder);
+    }
+
+    std::uint32_t RemainderBySmall(const Limb* lhs, std::size_t n, std::uint32_t divisor) noexcept {
+        assert(divisor);
+        std::uint64_t reminder { 0 };
+        for(std::size_t i = n; i-- > 0; ) {
+            reminder = (reminder * RADIX + lhs[i]) % divisor;
+        }
+        return static_cast<std::uint32_t>(reminder);
+    }
+
+    std::uint64_t Hash(const Limb* lhs, std::size_t n) noexcept {
+        constexpr std::uint64_t MULTIPLIER { 0x9E3779B97F4A7C15ULL };
+        constexpr std::size_t LANES { 4 };
+        std::uint64_t lanes[LANES] { 1, 2, 3, 4 };
+        std::size_t i { 0 };
+        for(; i + 2 * LANES <= n; i += 2 * LANES) {
+            for(std::size_t lane = 0; lane < LANES; lane++) {
+                const auto word { static_cast<std::uint64_t>(lhs[i + 2 * lane]) << 32 | static_cast<std::uint32_t>(lhs[i + 2 * lane + 1]) };
+                auto h { (lanes[lane] + word) * MULTIPLIER };
+                lanes[lane] = h ^ (h >> 32);
+            }
+        }
+        for(; i < n; i++) {
+            const auto h { (lanes[i % LANES] + static_cast<std::uint32_t>(lhs[i])) * MULTIPLIER };
+            lanes[i % LANES] = h ^ (h >> 32);
+        }
+        auto hash { static_cast<std::uint64_t>(n) };
+        for(const auto lane: lanes) {
+            hash = (hash ^ lane) * MULTIPLIER;
+            hash ^= hash >> 29;
+        }
+        // fmix64 of MurmurHash3
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    std::size_t Normalize(const Limb* lhs, std::size_t n) noexcept {
+        while( n && !lhs[n - 1] ) {
+            n--;
+        }
+        return n;
+    }
+}
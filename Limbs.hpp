@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Low-level kernels on raw little-endian arrays of limbs (BigInt's coefficients),
+ * in the spirit of GMP's mpn layer: no allocations, no signs, no normalization.
+ * Sizes are passed explicitly, temporary memory is provided by the caller.
+ * Unless stated otherwise the result may be the same array as an operand,
+ * but must not partially overlap it.
+ */
+namespace limbs {
+
+    using Limb = int;
+
+    // every limb is in [0, RADIX)
+    constexpr Limb RADIX = 1'000'000'000;
+    // operands with fewer limbs are multiplied by MultiplyBasecase
+    constexpr std::size_t KARATSUBA_THRESHOLD = 24;
+
+    /**
+     * result[0..n) = lhs[0..n) + rhs[0..n), returns carry (0 or 1). mpn_add_n
+     */
+    Limb Add(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t n) noexcept;
+
+    /**
+     * result[0..lhsSize) = lhs + rhs, lhsSize >= rhsSize, returns carry. mpn_add
+     */
+    Limb Add(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize) noexcept;
+
+    /**
+     * result[0..n) = lhs[0..n) - rhs[0..n), returns borrow (0 or 1). mpn_sub_n
+     */
+    Limb Substract(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t n) noexcept;
+
+    /**
+     * result[0..lhsSize) = lhs - rhs, lhsSize >= rhsSize, returns borrow. mpn_sub
+     */
+    Limb Substract(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize) noexcept;
+
+    /**
+     * result[0..n) = lhs[0..n) * factor, returns the highest limb of the product. mpn_mul_1
+     */
+    Limb MultiplyBySmall(Limb* result, const Limb* lhs, std::size_t n, Limb factor) noexcept;
+
+    /**
+     * result[0..n) += lhs[0..n) * factor, returns carry limb. mpn_addmul_1
+     */
+    Limb AddMultiplyBySmall(Limb* result, const Limb* lhs, std::size_t n, Limb factor) noexcept;
+
+    /**
+     * result[0..n) -= lhs[0..n) * factor, returns borrow limb. mpn_submul_1
+     */
+    Limb SubstractMultiplyBySmall(Limb* result, const Limb* lhs, std::size_t n, Limb factor) noexcept;
+
+    /**
+     * result[0..lhsSize + rhsSize) = lhs * rhs by the school-like algorithm, O(n*m).
+     * The result must not overlap the operands. mpn_mul_basecase
+     */
+    void MultiplyBasecase(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize) noexcept;
+
+    /**
+     * Number of scratch limbs needed by MultiplyKaratsuba for n-limb operands.
+     */
+    std::size_t KaratsubaScratchSize(std::size_t n) noexcept;
+
+    /**
+     * result[0..2n) = lhs[0..n) * rhs[0..n), O(n^(1.585)):
+     * A = a * x + b, B = c * x + d =>
+     * A * B = ac * xx + x * ((a + b)(c + d) - ac - bd) + bd.
+     * The result must not overlap the operands, @scratch has KaratsubaScratchSize(n) limbs.
+     */
+    void MultiplyKaratsuba(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t n, Limb* scratch) noexcept;
+
+    /**
+     * Number of scratch limbs needed by Multiply, lhsSize >= rhsSize.
+     */
+    std::size_t MultiplyScratchSize(std::size_t lhsSize, std::size_t rhsSize) noexcept;
+
+    /**
+     * result[0..lhsSize + rhsSize) = lhs * rhs, lhsSize >= rhsSize.
+     * Unbalanced operands are multiplied by rhs-sized blocks of lhs.
+     * The result must not overlap the operands, @scratch has MultiplyScratchSize limbs. mpn_mul
+     */
+    void Multiply(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize, Limb* scratch) noexcept;
+
+    /**
+     * Compares lhs[0..n) and rhs[0..n): negative, zero or positive value. mpn_cmp
+     */
+    int Compare(const Limb* lhs, const Limb* rhs, std::size_t n) noexcept;
+
+    /**
+     * quotient[0..n) = lhs[0..n) / divisor, returns the reminder, 0 < divisor. mpn_divrem_1
+     */
+    std::uint32_t DivideBySmall(Limb* quotient, const Limb* lhs, std::size_t n, std::uint32_t divisor) noexcept;
+
+    /**
+     * lhs[0..n) mod divisor, 0 < divisor. mpn_mod_1
+     */
+    std::uint32_t RemainderBySmall(const Limb* lhs, std::size_t n, std::uint32_t divisor) noexcept;
+
+    /**
+     * 64-bit hash of lhs[0..n): pairs of limbs are mixed into four independent lanes
+     * (add, multiply, xor-shift), so the loop has no dependency between neighbour words
+     * and is vectorized, the lanes and n are combined by the MurmurHash3 finalizer.
+     */
+    std::uint64_t Hash(const Limb* lhs, std::size_t n) noexcept;
+
+    /**
+     * Size of lhs[0..n) without leading zero limbs.
+     */
+    std::size_t Normalize(const Limb* lhs, std::size_t n) noexcept;
+}
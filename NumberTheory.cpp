@@ -0,0 +1,443 @@
+#include "NumberTheory.hpp"
+#include <array>
+#include <cmath>
+
+namespace helper {
+
+    /**
+     * Friend class of BigInt: gcd machinery works with coefficients directly.
+     */
+    class NumberTheory final {
+    public:
+
+        /**
+         * Unimodular transformation (det = +-1) applied to the pair (a, b):
+         * a' = m00 * a + m01 * b
+         * b' = m10 * a + m11 * b
+         */
+        struct Matrix {
+            BigInt m00 { 1 }, m01 { 0 };
+            BigInt m10 { 0 }, m11 { 1 };
+        };
+
+        // pairs with fewer coefficients are reduced by Lehmer's algorithm only
+        static constexpr size_t HALF_GCD_THRESHOLD = 64;
+
+        static BigInt Gcd(const BigInt& lhs, const BigInt& rhs) {
+            auto a { Abs(lhs) }, b { Abs(rhs) };
+            if( a.CompareMagnitude(b) < 0 ) {
+                std::swap(a, b);
+            }
+            // reduce until both operands fit into 64 bits
+            Reduce(a, b, nullptr, 2u);
+            if( b.IsZero() ) {
+                return a;
+            }
+            a = a.DivMod(b).second;
+            return BigInt { static_cast<long long>(BinaryGcd(ToUnsigned(a), ToUnsigned(b))) };
+        }
+
+        static std::tuple<BigInt, BigInt, BigInt> ExtendedGcd(const BigInt& lhs, const BigInt& rhs) {
+            auto a { Abs(lhs) }, b { Abs(rhs) };
+            Matrix m;
+            if( a.CompareMagnitude(b) < 0 ) {
+                std::swap(a, b);
+                std::swap(m.m00, m.m10);
+                std::swap(m.m01, m.m11);
+            }
+            // (gcd, 0) = m * (|lhs|, |rhs|)
+            Reduce(a, b, &m, 0u);
+            if( !lhs.IsPositive() ) Negate(m.m00);
+            if( !rhs.IsPositive() ) Negate(m.m01);
+            return { std::move(a), std::move(m.m00), std::move(m.m01) };
+        }
+
+        static BigInt IntegerRoot(const BigInt& value, unsigned degree) {
+            if( !degree ) {
+                throw std::domain_error("BigInt: zero degree of root");
+            }
+            if( degree == 1u ) {
+                return value;
+            }
+            if( value.IsPositive() ) {
+                return Root(value, degree);
+            }
+            if( !(degree & 1u) ) {
+                throw std::domain_error("BigInt: even degree root of negative value");
+            }
+            auto root { Root(Abs(value), degree) };
+            Negate(root);
+            return root;
+        }
+
+        static bool IsPerfectSquare(const BigInt& value) {
+            if( !value.IsPositive() ) {
+                return false;
+            }
+            // RADIX = 2^9 * 5^9, so the lowest coefficient gives residues modulo 64 and 25
+            const auto lowest { static_cast<unsigned>(value.m_coefficients.front()) };
+            if( !IsSquareResidue<64>(lowest % 64) || !IsSquareResidue<25>(lowest % 25) ) {
+                return false;
+            }
+            const auto residue { value.RemainderBySmall(63 * 65 * 11) };
+            if( !IsSquareResidue<63>(residue % 63) 
+                || !IsSquareResidue<65>(residue % 65) 
+                || !IsSquareResidue<11>(residue % 11) 
+            ) {
+                return false;
+            }
+            const auto root { Root(value, 2u) };
+            return root * root == value;
+        }
+
+        static bool IsPerfectPower(const BigInt& value) {
+            const auto magnitude { Abs(value) };
+            if( magnitude.CompareMagnitude(BigInt{ 1 }) <= 0 ) {
+                return true;
+            }
+            if( value.IsPositive() && IsPerfectSquare(value) ) {
+                return true;
+            }
+            // x^k = (x^(k/p))^p for any prime p | k, so only odd prime exponents are left
+            const auto bits { BitLength(magnitude) };
+            for(unsigned p = 3; p <= bits; p += 2) {
+                if( IsSmallPrime(p) 
+                    && IsPowerResidue(magnitude, p) 
+                    && Power(Root(magnitude, p), p) == magnitude 
+                ) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+
+        static BigInt Abs(BigInt x) noexcept {
+            x.m_isPositive = true;
+            return x;
+        }
+
+        static void Negate(BigInt& x) noexcept {
+            x.m_isPositive = !x.m_isPositive || x.IsZero();
+        }
+
+        static std::uint64_t ToUnsigned(const BigInt& x) noexcept {
+            assert(x.m_coefficients.size() <= 2u);
+            std::uint64_t value { 0 };
+            for(size_t i = x.m_coefficients.size(); i-- > 0; ) {
+                value = value * BigInt::RADIX + x.m_coefficients[i];
+            }
+            return value;
+        }
+
+        // Stein's algorithm
+        static std::uint64_t BinaryGcd(std::uint64_t a, std::uint64_t b) noexcept {
+            if( !a || !b ) return a | b;
+            const auto shift { __builtin_ctzll(a | b) };
+            a >>= __builtin_ctzll(a);
+            do {
+                b >>= __builtin_ctzll(b);
+                if( a > b ) std::swap(a, b);
+                b -= a;
+            } while( b );
+            return a << shift;
+        }
+
+        // floor(log2(x)) + 1, x > 0
+        static unsigned BitLength(const BigInt& x) noexcept {
+            const auto size { x.m_coefficients.size() };
+            return static_cast<unsigned>(
+                std::log2(static_cast<double>(x.m_coefficients.back())) 
+                + (size - 1) * std::log2(static_cast<double>(BigInt::RADIX))
+            ) + 1u;
+        }
+
+        template<unsigned Modulus>
+        static bool IsSquareResidue(unsigned residue) {
+            static const auto squares = [] {
+                std::array<bool, Modulus> table {};
+                for(unsigned i = 0; i < Modulus; i++) {
+                    table[i * i % Modulus] = true;
+                }
+                return table;
+            }();
+            return squares[residue];
+        }
+
+        static bool IsSmallPrime(std::uint32_t x) noexcept {
+            if( x < 4u ) return x > 1u;
+            if( !(x & 1u) ) return false;
+            for(std::uint32_t d = 3; d * d <= x; d += 2) {
+                if( !(x % d) ) return false;
+            }
+            return true;
+        }
+
+        static std::uint64_t PowMod(std::uint64_t base, std::uint64_t exponent, std::uint64_t modulus) noexcept {
+            assert(modulus < (1ULL << 32));
+            std::uint64_t result { 1 };
+            base %= modulus;
+            for(; exponent; exponent >>= 1u) {
+                if( exponent & 1u ) result = result * base % modulus;
+                base = base * base % modulus;
+            }
+            return result;
+        }
+
+        /** @brief
+         * If x = y^p then x^((q - 1) / p) = 0 or 1 (mod q) for prime q = 1 (mod p).
+         * Non-powers pass each such check with probability about 1/p.
+         * @note
+         * p must be a prime.
+         */
+        static bool IsPowerResidue(const BigInt& x, unsigned p) {
+            constexpr unsigned CHECKS { 4 };
+            unsigned checks { 0 };
+            for(std::uint32_t q = 2 * p + 1; checks < CHECKS; q += 2 * p) {
+                if( !IsSmallPrime(q) ) continue;
+                checks++;
+                const auto residue { x.RemainderBySmall(q) };
+                if( residue && PowMod(residue, (q - 1) / p, q) != 1u ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static BigInt Power(const BigInt& base, unsigned exponent) {
+            BigInt result { 1 };
+            auto square { base };
+            while( exponent ) {
+                if( exponent & 1u ) {
+                    result = KaratsubaMultiplication(result, square);
+                }
+                exponent >>= 1u;
+                if( exponent ) {
+                    square = KaratsubaMultiplication(square, square);
+                }
+            }
+            return result;
+        }
+
+        /** @brief
+         * Upper bound of k-th root for value < RADIX^(2k), 
+         * i.e. the root fits into 64 bits.
+         */
+        static BigInt RootEstimate(const BigInt& value, unsigned k) {
+            const auto& c { value.m_coefficients };
+            const auto size { c.size() };
+            double top { static_cast<double>(c[size - 1]) };
+            if( size > 1u ) {
+                top = top * BigInt::RADIX + c[size - 2];
+            }
+            const auto log { std::log(top) + (size > 1u? size - 2: 0) * std::log(static_cast<double>(BigInt::RADIX)) };
+            BigInt x { static_cast<long long>(std::exp(log / k) * (1.0 + 1e-9)) + 2 };
+            while( Power(x, k).CompareMagnitude(value) <= 0 ) {
+                x = x * BigInt{ 2 };
+            }
+            return x;
+        }
+
+        /** @brief
+         * k-th root of non-negative value rounded down.
+         * The root of the highest coefficients (half of the precision) is computed 
+         * recursively. It gives an upper bound for Newton's iteration 
+         * which converges from above in a couple of steps.
+         */
+        static BigInt Root(const BigInt& value, unsigned k) {
+            assert(value.IsPositive() && k >= 2u);
+            if( value.IsZero() ) {
+                return value;
+            }
+            const auto shift { value.m_coefficients.size() / (2u * k) };
+            auto x { shift? 
+                (Root(value.ShiftRight(shift * k), k) + BigInt{ 1 }).ShiftLeft(shift) 
+                : RootEstimate(value, k) 
+            };
+            // x' = ((k - 1) * x + value / x^(k - 1)) / k
+            while( true ) {
+                auto next { value / Power(x, k - 1) + x * BigInt{ k - 1 } };
+                next.DivideBySmall(k);
+                if( next.CompareMagnitude(x) >= 0 ) break;
+                x = std::move(next);
+            }
+            return x;
+        }
+
+        // m = lhs * rhs
+        static Matrix Multiply(const Matrix& lhs, const Matrix& rhs) {
+            return {
+                KaratsubaMultiplication(lhs.m00, rhs.m00) + KaratsubaMultiplication(lhs.m01, rhs.m10),
+                KaratsubaMultiplication(lhs.m00, rhs.m01) + KaratsubaMultiplication(lhs.m01, rhs.m11),
+                KaratsubaMultiplication(lhs.m10, rhs.m00) + KaratsubaMultiplication(lhs.m11, rhs.m10),
+                KaratsubaMultiplication(lhs.m10, rhs.m01) + KaratsubaMultiplication(lhs.m11, rhs.m11)
+            };
+        }
+
+        /** @brief
+         * One step of Euclid's algorithm: (a, b) => (b, a mod b)
+         */
+        static void EuclidStep(BigInt& a, BigInt& b, Matrix* m) {
+            auto [q, r] = a.DivMod(b);
+            a = std::move(b);
+            b = std::move(r);
+            if( m ) {
+                // (row0, row1) => (row1, row0 - q * row1)
+                auto m10 { m->m00 - q * m->m10 };
+                auto m11 { m->m01 - q * m->m11 };
+                m->m00 = std::move(m->m10);
+                m->m01 = std::move(m->m11);
+                m->m10 = std::move(m10);
+                m->m11 = std::move(m11);
+            }
+        }
+
+        /** @brief
+         * Lehmer's algorithm (Knuth, TAOCP vol.2, 4.5.2, Algorithm L).
+         * Quotients are computed by the two highest coefficients of (a, b)
+         * while they're guaranteed to match the quotients of the whole numbers,
+         * then cofactors are applied to (a, b) at once.
+         * @note
+         * Expect a >= b >= 0.
+         * Reduce until b has at most @stop coefficients or becomes zero.
+         */
+        static void LehmerReduce(BigInt& a, BigInt& b, Matrix* m, size_t stop) {
+            constexpr long long RADIX { BigInt::RADIX };
+            while( b.m_coefficients.size() > stop && !b.IsZero() ) {
+                const auto& u { a.m_coefficients };
+                const auto& v { b.m_coefficients };
+                const auto n { u.size() };
+                // highest coefficients of a and b at the same ranks
+                long long uhat { u[n - 1] }, vhat { v.size() == n? v[n - 1]: 0 };
+                if( n > 1u ) {
+                    uhat = uhat * RADIX + u[n - 2];
+                    vhat = vhat * RADIX + (v.size() + 1u >= n? v[n - 2]: 0);
+                }
+                long long A { 1 }, B { 0 }, C { 0 }, D { 1 };
+                while( vhat + C > 0 && vhat + D > 0 ) {
+                    const auto q { (uhat + A) / (vhat + C) };
+                    if( q != (uhat + B) / (vhat + D) ) break;
+                    auto t { A - q * C };
+                    A = C, C = t;
+                    t = B - q * D;
+                    B = D, D = t;
+                    t = uhat - q * vhat;
+                    uhat = vhat, vhat = t;
+                }
+
+                if( !B ) {
+                    // quotient is too large for single precision
+                    EuclidStep(a, b, m);
+                    continue;
+                }
+
+                auto na { BigInt{ A } * a + BigInt{ B } * b };
+                auto nb { BigInt{ C } * a + BigInt{ D } * b };
+                assert(na.IsPositive() && nb.IsPositive());
+                a = std::move(na);
+                b = std::move(nb);
+                if( m ) {
+                    Matrix cofactors { BigInt{ A }, BigInt{ B }, BigInt{ C }, BigInt{ D } };
+                    *m = Multiply(cofactors, *m);
+                }
+            }
+        }
+
+        /** @brief
+         * Half-gcd: the highest coefficients of (a, b) are reduced recursively,
+         * the resulting matrix is applied to the whole (a, b) by fast multiplication.
+         * Any matrix is unimodular so gcd (and cofactors) stays correct,
+         * the signs and order are fixed after each application.
+         * @note
+         * Expect a >= b >= 0.
+         * Reduce until b has at most @stop coefficients or becomes zero.
+         */
+        static void Reduce(BigInt& a, BigInt& b, Matrix* m, size_t stop) {
+            while( b.m_coefficients.size() > stop && !b.IsZero() ) {
+                const auto n { a.m_coefficients.size() };
+                if( n < HALF_GCD_THRESHOLD ) {
+                    LehmerReduce(a, b, m, stop);
+                    return;
+                }
+                // reducing highest (n - p) coefficients by half reduce (a, b) by (n - p) / 2
+                const auto p { std::max(n / 2, 2 * stop > n? 2 * stop - n: 0u) };
+                auto a0 { a.ShiftRight(p) }, b0 { b.ShiftRight(p) };
+                Matrix r;
+                Reduce(a0, b0, &r, (n - p) / 2 + 1);
+
+                auto na { KaratsubaMultiplication(r.m00, a) + KaratsubaMultiplication(r.m01, b) };
+                auto nb { KaratsubaMultiplication(r.m10, a) + KaratsubaMultiplication(r.m11, b) };
+                if( !na.IsPositive() ) {
+                    Negate(na), Negate(r.m00), Negate(r.m01);
+                }
+                if( !nb.IsPositive() ) {
+                    Negate(nb), Negate(r.m10), Negate(r.m11);
+                }
+                if( na.CompareMagnitude(nb) < 0 ) {
+                    std::swap(na, nb);
+                    std::swap(r.m00, r.m10);
+                    std::swap(r.m01, r.m11);
+                }
+                if( na.CompareMagnitude(a) >= 0 ) {
+                    // highest coefficients haven't been reduced or
+                    // the quotient is too large: fallback to division
+                    EuclidStep(a, b, m);
+                    continue;
+                }
+                a = std::move(na);
+                b = std::move(nb);
+                if( m ) {
+                    *m = Multiply(r, *m);
+                }
+            }
+        }
+    };
+}
+
+BigInt Gcd(const BigInt& lhs, const BigInt& rhs) {
+    return helper::NumberTheory::Gcd(lhs, rhs);
+}
+
+std::tuple<BigInt, BigInt, BigInt> ExtendedGcd(const BigInt& lhs, const BigInt& rhs) {
+    return helper::NumberTheory::ExtendedGcd(lhs, rhs);
+}
+
+BigInt ModularInverse(const BigInt& value, const BigInt& modulus) {
+    if( !modulus.IsPositive() || modulus.IsZero() ) {
+        throw std::domain_error("BigInt: modulus must be positive");
+    }
+    auto residue { value % modulus };
+    if( !residue.IsPositive() ) {
+        residue += modulus;
+    }
+    auto [gcd, inverse, unused] = ExtendedGcd(residue, modulus);
+    (void)unused;
+    if( gcd != BigInt{ 1 } ) {
+        throw std::domain_error("BigInt: value isn't invertible");
+    }
+    inverse %= modulus;
+    if( !inverse.IsPositive() ) {
+        inverse += modulus;
+    }
+    return inverse;
+}
+
+BigInt IntegerSqrt(const BigInt& value) {
+    if( !value.IsPositive() ) {
+        throw std::domain_error("BigInt: square root of negative value");
+    }
+    return helper::NumberTheory::IntegerRoot(value, 2u);
+}
+
+BigInt IntegerRoot(const BigInt& value, unsigned degree) {
+    return helper::NumberTheory::IntegerRoot(value, degree);
+}
+
+bool IsPerfectSquare(const BigInt& value) {
+    return helper::NumberTheory::IsPerfectSquare(value);
+}
+
+bool IsPerfectPower(const BigInt& value) {
+    return helper::NumberTheory::IsPerfectPower(value);
+}
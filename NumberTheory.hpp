@@ -0,0 +1,51 @@
+#pragma once
+
+#include "BigInt.hpp"
+#include <tuple>
+
+/**
+ * Greatest common divisor of absolute values, Gcd(0, 0) = 0.
+ * - operands fitting into 64 bits: binary gcd;
+ * - medium operands: Lehmer's algorithm (quotients are computed
+ *   on the two highest coefficients);
+ * - large operands: half-gcd, i.e. recursive Lehmer applied to the
+ *   highest halves, so the work is done by KaratsubaMultiplication.
+ */
+BigInt Gcd(const BigInt& lhs, const BigInt& rhs);
+
+/**
+ * Returns (g, s, t) such that lhs * s + rhs * t = g, where g = Gcd(lhs, rhs).
+ */
+std::tuple<BigInt, BigInt, BigInt> ExtendedGcd(const BigInt& lhs, const BigInt& rhs);
+
+/**
+ * Returns x, 0 <= x < modulus, such that value * x = 1 (mod modulus).
+ * Throws std::domain_error if modulus isn't positive or value isn't invertible.
+ */
+BigInt ModularInverse(const BigInt& value, const BigInt& modulus);
+
+/**
+ * The largest x such that x * x <= value.
+ * Newton's iteration, precision doubles on each level of recursion.
+ * Throws std::domain_error for negative value.
+ */
+BigInt IntegerSqrt(const BigInt& value);
+
+/**
+ * The k-th root of value rounded toward zero, k = degree.
+ * Throws std::domain_error if degree is zero or value is negative and degree is even.
+ */
+BigInt IntegerRoot(const BigInt& value, unsigned degree);
+
+/**
+ * Most of non-squares are rejected by residues (mod 64, 25, 63, 65, 11)
+ * before any root is computed.
+ */
+bool IsPerfectSquare(const BigInt& value);
+
+/**
+ * Whether value = x^k for some integer x and k >= 2.
+ * For each prime k the residues modulo primes q = 1 (mod k) are checked first,
+ * the root is computed for candidates only.
+ */
+bool IsPerfectPower(const BigInt& value);
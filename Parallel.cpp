@@ -0,0 +1,124 @@
+#include "Parallel.hpp"
+
+namespace helper {
+
+    /**
+     * Friend class of BigInt: blocks of coefficients are processed by the limbs kernels.
+     */
+    class Parallel final {
+    public:
+
+        static BigInt Sum(const BigInt& lhs, const BigInt& rhs, bool isRhsPositive, unsigned threadCount) {
+            BigInt result;
+            if( lhs.m_isPositive == isRhsPositive ) {
+                const auto& [larger, smaller] = lhs.m_coefficients.size() >= rhs.m_coefficients.size()?
+                    std::tie(lhs, rhs): std::tie(rhs, lhs);
+                result = Add(larger, smaller, threadCount);
+                result.m_isPositive = lhs.m_isPositive;
+            }
+            else if( lhs.CompareMagnitude(rhs) >= 0 ) {
+                result = Substract(lhs, rhs, threadCount);
+                result.m_isPositive = lhs.m_isPositive;
+            }
+            else {
+                result = Substract(rhs, lhs, threadCount);
+                result.m_isPositive = isRhsPositive;
+            }
+            auto& coefficients { result.m_coefficients };
+            coefficients.resize(limbs::Normalize(coefficients.data(), coefficients.size()));
+            if( coefficients.empty() ) {
+                return BigInt{};
+            }
+            return result;
+        }
+
+    private:
+
+        // fewer coefficients aren't worth a thread
+        static constexpr size_t MIN_BLOCK_SIZE = 1u << 16;
+
+        static size_t BlockCount(size_t size, unsigned threadCount) noexcept {
+            return std::max<size_t>(1u, std::min<size_t>(std::max(threadCount, 1u), size / MIN_BLOCK_SIZE));
+        }
+
+        /**
+         * |lhs| + |rhs|, lhs has at least as many coefficients as rhs.
+         */
+        static BigInt Add(const BigInt& lhs, const BigInt& rhs, unsigned threadCount) {
+            const auto lhsSize { lhs.m_coefficients.size() };
+            const auto rhsSize { rhs.m_coefficients.size() };
+            const auto blocks { BlockCount(lhsSize, threadCount) };
+            BigInt result;
+            result.m_coefficients.resize(lhsSize + 1);
+            const auto out { result.m_coefficients.data() };
+            const auto left { lhs.m_coefficients.data() };
+            const auto right { rhs.m_coefficients.data() };
+
+            std::vector<limbs::Limb> carries(blocks);
+            ParallelFor(blocks, static_cast<unsigned>(blocks), [&](size_t block) {
+                const auto first { lhsSize * block / blocks };
+                const auto last { lhsSize * (block + 1) / blocks };
+                const auto overlap { std::clamp(rhsSize, first, last) - first };
+                carries[block] = overlap?
+                    limbs::Add(out + first, left + first, last - first, right + first, overlap):
+                    limbs::Add(out + first, left + first, last - first, nullptr, 0);
+            });
+            // the carry into a block ripples through its highest nines only
+            limbs::Limb carry { 0 };
+            for(size_t block = 0; block < blocks; block++) {
+                const auto first { lhsSize * block / blocks };
+                const auto last { lhsSize * (block + 1) / blocks };
+                if( carry ) {
+                    carry = limbs::Add(out + first, out + first, last - first, &carry, 1);
+                }
+                carry |= carries[block];
+            }
+            out[lhsSize] = carry;
+            return result;
+        }
+
+        /**
+         * |lhs| - |rhs|, |lhs| >= |rhs|.
+         */
+        static BigInt Substract(const BigInt& lhs, const BigInt& rhs, unsigned threadCount) {
+            const auto lhsSize { lhs.m_coefficients.size() };
+            const auto rhsSize { rhs.m_coefficients.size() };
+            const auto blocks { BlockCount(lhsSize, threadCount) };
+            BigInt result;
+            result.m_coefficients.resize(lhsSize);
+            const auto out { result.m_coefficients.data() };
+            const auto left { lhs.m_coefficients.data() };
+            const auto right { rhs.m_coefficients.data() };
+
+            std::vector<limbs::Limb> borrows(blocks);
+            ParallelFor(blocks, static_cast<unsigned>(blocks), [&](size_t block) {
+                const auto first { lhsSize * block / blocks };
+                const auto last { lhsSize * (block + 1) / blocks };
+                const auto overlap { std::clamp(rhsSize, first, last) - first };
+                borrows[block] = overlap?
+                    limbs::Substract(out + first, left + first, last - first, right + first, overlap):
+                    limbs::Substract(out + first, left + first, last - first, nullptr, 0);
+            });
+            // the borrow from a block ripples through its lowest zeros only
+            limbs::Limb borrow { 0 };
+            for(size_t block = 0; block < blocks; block++) {
+                const auto first { lhsSize * block / blocks };
+                const auto last { lhsSize * (block + 1) / blocks };
+                if( borrow ) {
+                    borrow = limbs::Substract(out + first, out + first, last - first, &borrow, 1);
+                }
+                borrow |= borrows[block];
+            }
+            assert(!borrow);
+            return result;
+        }
+    };
+}
+
+BigInt ParallelAdd(const BigInt& lhs, const BigInt& rhs, unsigned threadCount) {
+    return helper::Parallel::Sum(lhs, rhs, rhs.IsPositive(), threadCount);
+}
+
+BigInt ParallelSubstract(const BigInt& lhs, const BigInt& rhs, unsigned threadCount) {
+    return helper::Parallel::Sum(lhs, rhs, !rhs.IsPositive() || rhs.IsZero(), threadCount);
+}
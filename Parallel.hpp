@@ -0,0 +1,44 @@
+#pragma once
+
+#include "BigInt.hpp"
+#include <future>
+#include <thread>
+
+/**
+ * Calls function(i) for i in [0, count), contiguous ranges of indices
+ * are shared between @threadCount threads.
+ */
+template<typename Function>
+void ParallelFor(size_t count, unsigned threadCount, const Function& function) {
+    const auto ranges { std::min<size_t>(count, std::max(threadCount, 1u)) };
+    std::vector<std::future<void>> tasks;
+    for(size_t range = 1; range < ranges; range++) {
+        tasks.push_back(std::async(std::launch::async,
+            [&function, first = count * range / ranges, last = count * (range + 1) / ranges]() {
+                for(auto i { first }; i < last; i++) {
+                    function(i);
+                }
+            }
+        ));
+    }
+    for(size_t i = 0; ranges && i < count / ranges; i++) {
+        function(i);
+    }
+    for(auto& task: tasks) {
+        task.get();
+    }
+}
+
+/**
+ * lhs + rhs for huge operands, memory-bound on a single core.
+ * Coefficients are split into @threadCount blocks added in parallel with zero carry-in,
+ * then a sequential pass propagates the carry out of each block into the next one:
+ * it stops at the first coefficient below RADIX - 1, so it's short unless the block is all nines.
+ * Blocks have at least 2^16 coefficients, so short operands are added by one thread.
+ */
+BigInt ParallelAdd(const BigInt& lhs, const BigInt& rhs, unsigned threadCount = std::thread::hardware_concurrency());
+
+/**
+ * lhs - rhs, borrows are resolved like the carries of ParallelAdd.
+ */
+BigInt ParallelSubstract(const BigInt& lhs, const BigInt& rhs, unsigned threadCount = std::thread::hardware_concurrency());
@@ -0,0 +1,640 @@
+#include "Primality.hpp"
+#include "Async.hpp"
+#include "NumberTheory.hpp"
+#include <array>
+#include <atomic>
+#include <random>
+#include <thread>
+
+namespace helper {
+
+    /**
+     * Friend class of BigInt: Montgomery arithmetic works with coefficients directly.
+     */
+    class Primality final {
+    public:
+
+        // primes below the bound are found by trial division
+        static constexpr std::uint32_t TRIAL_BOUND = 2000;
+        // NextPrime sieves candidates by primes below the bound
+        static constexpr std::uint32_t SIEVE_BOUND = 1u << 16;
+        // odd candidates sieved at once by NextPrime
+        static constexpr size_t SIEVE_WINDOW = 4096;
+
+        // value modulo m, exactly n coefficients (n - size of m)
+        using Residue = std::vector<int>;
+
+        /**
+         * Montgomery form of x is x * R mod m, where R = RADIX^n, n - size of m.
+         * Multiplication doesn't need any division: a * b * R^(-1) mod m (REDC).
+         * Requires gcd(m, RADIX) = 1, i.e. m isn't divisible by 2 and 5.
+         */
+        class Montgomery final {
+        public:
+            explicit Montgomery(const BigInt& modulus) :
+                m_modulus { modulus.m_coefficients }
+            {
+                assert(modulus.IsPositive() && (modulus.m_coefficients.front() & 1) && modulus.m_coefficients.front() % 5);
+                const auto n { m_modulus.size() };
+                // -m^(-1) mod RADIX by extended Euclid's algorithm
+                long long r0 { BigInt::RADIX }, r1 { m_modulus.front() }, t0 { 0 }, t1 { 1 };
+                while( r1 ) {
+                    const auto q { r0 / r1 };
+                    r0 -= q * r1, std::swap(r0, r1);
+                    t0 -= q * t1, std::swap(t0, t1);
+                }
+                assert(r0 == 1);
+                m_inverse = static_cast<std::uint64_t>((BigInt::RADIX - t0 % BigInt::RADIX) % BigInt::RADIX);
+
+                m_one = Pad(BigInt{ 1 }.ShiftLeft(n) % modulus);
+                m_square = Pad(BigInt{ 1 }.ShiftLeft(2 * n) % modulus);
+            }
+
+            const Residue& One() const noexcept {
+                return m_one;
+            }
+
+            Residue Zero() const {
+                return Residue(m_modulus.size(), 0);
+            }
+
+            // expect 0 <= x < m
+            Residue ToMontgomery(const BigInt& x) const {
+                return this->Multiply(Pad(x), m_square);
+            }
+
+            BigInt FromMontgomery(const Residue& x) const {
+                auto unit { this->Zero() };
+                unit.front() = 1;
+                BigInt result;
+                result.m_coefficients = this->Multiply(x, unit);
+                while(result.m_coefficients.size() > 1u && !result.m_coefficients.back()) {
+                    result.m_coefficients.pop_back();
+                }
+                return result;
+            }
+
+            /** @brief
+             * a * b * R^(-1) mod m, product scanning (Montgomery reduction interleaved 
+             * column by column): each column is summed in 128 bits and 
+             * divided by RADIX once, not after every product.
+             * Time complexity: O(n*n)
+             */
+            Residue Multiply(const Residue& a, const Residue& b) const {
+                constexpr std::uint64_t RADIX { BigInt::RADIX };
+                using Accumulator = unsigned __int128;
+                const auto n { m_modulus.size() };
+                // u[i] are chosen so the lowest i-th coefficient of (a * b + u * m) vanishes
+                std::vector<std::uint64_t> u (n);
+                Residue result (n);
+                Accumulator column { 0 };
+                for(size_t i = 0; i < n; i++) {
+                    Accumulator other { 0 };
+                    for(size_t j = 0; j < i; j++) {
+                        column += static_cast<std::uint64_t>(a[j]) * static_cast<std::uint64_t>(b[i - j]);
+                        other += u[j] * static_cast<std::uint64_t>(m_modulus[i - j]);
+                    }
+                    column += other;
+                    column += static_cast<std::uint64_t>(a[i]) * static_cast<std::uint64_t>(b[0]);
+                    u[i] = static_cast<std::uint64_t>(column % RADIX) * m_inverse % RADIX;
+                    column += u[i] * static_cast<std::uint64_t>(m_modulus[0]);
+                    column /= RADIX;
+                }
+                for(size_t i = n; i < 2 * n; i++) {
+                    Accumulator other { 0 };
+                    for(size_t j = i - n + 1; j < n; j++) {
+                        column += static_cast<std::uint64_t>(a[j]) * static_cast<std::uint64_t>(b[i - j]);
+                        other += u[j] * static_cast<std::uint64_t>(m_modulus[i - j]);
+                    }
+                    column += other;
+                    result[i - n] = static_cast<int>(column % RADIX);
+                    column /= RADIX;
+                }
+                // the result < 2m
+                if( column || !this->IsLesser(result) ) {
+                    SubstractModulus(result);
+                }
+                return result;
+            }
+
+            Residue Add(const Residue& a, const Residue& b) const {
+                Residue sum (a.size());
+                int carry { 0 };
+                for(size_t i = 0; i < a.size(); i++) {
+                    sum[i] = a[i] + b[i] + carry;
+                    carry = sum[i] >= BigInt::RADIX;
+                    if( carry ) sum[i] -= BigInt::RADIX;
+                }
+                if( carry || !this->IsLesser(sum) ) {
+                    SubstractModulus(sum);
+                }
+                return sum;
+            }
+
+            Residue Substract(const Residue& a, const Residue& b) const {
+                Residue diff (a.size());
+                int borrow { 0 };
+                for(size_t i = 0; i < a.size(); i++) {
+                    diff[i] = a[i] - b[i] - borrow;
+                    borrow = diff[i] < 0;
+                    if( borrow ) diff[i] += BigInt::RADIX;
+                }
+                if( borrow ) {
+                    // wrap around: diff + m
+                    int carry { 0 };
+                    for(size_t i = 0; i < diff.size(); i++) {
+                        diff[i] += m_modulus[i] + carry;
+                        carry = diff[i] >= BigInt::RADIX;
+                        if( carry ) diff[i] -= BigInt::RADIX;
+                    }
+                }
+                return diff;
+            }
+
+            // x / 2 mod m, m is odd so (x + m) is even when x is odd
+            Residue Half(Residue x) const {
+                int carry { 0 };
+                // RADIX is even, so parity is defined by the lowest coefficient
+                if( x.front() & 1 ) {
+                    for(size_t i = 0; i < x.size(); i++) {
+                        x[i] += m_modulus[i] + carry;
+                        carry = x[i] >= BigInt::RADIX;
+                        if( carry ) x[i] -= BigInt::RADIX;
+                    }
+                }
+                for(size_t i = x.size(); i-- > 0; ) {
+                    const auto cur { 1LL * carry * BigInt::RADIX + x[i] };
+                    x[i] = static_cast<int>(cur >> 1);
+                    carry = static_cast<int>(cur & 1);
+                }
+                return x;
+            }
+
+            /** @brief
+             * base^(exponent >> lowestBit), fixed window of 4 bits.
+             * @exponent is given in binary, see ToBinary.
+             */
+            Residue Power(const Residue& base, const std::vector<std::uint32_t>& exponent, size_t lowestBit) const {
+                constexpr size_t WINDOW { 4 };
+                const auto bits { BitLength(exponent) };
+                if( bits <= lowestBit ) {
+                    return m_one;
+                }
+                std::array<Residue, 1u << WINDOW> table;
+                table[0] = m_one;
+                for(size_t i = 1; i < table.size(); i++) {
+                    table[i] = this->Multiply(table[i - 1], base);
+                }
+                const auto windows { (bits - lowestBit + WINDOW - 1) / WINDOW };
+                ProgressScope progress { windows };
+                Residue result;
+                for(size_t w = windows; w-- > 0; progress.Step()) {
+                    size_t index { 0 };
+                    for(size_t bit = WINDOW; bit-- > 0; ) {
+                        index = (index << 1u) | Bit(exponent, lowestBit + w * WINDOW + bit);
+                    }
+                    if( w + 1u == windows ) {
+                        result = table[index];
+                        continue;
+                    }
+                    for(size_t i = 0; i < WINDOW; i++) {
+                        result = this->Multiply(result, result);
+                    }
+                    if( index ) {
+                        result = this->Multiply(result, table[index]);
+                    }
+                }
+                return result;
+            }
+
+        private:
+
+            Residue Pad(const BigInt& x) const {
+                auto padded { x.m_coefficients };
+                padded.resize(m_modulus.size(), 0);
+                return padded;
+            }
+
+            bool IsLesser(const Residue& x) const noexcept {
+                for(size_t i = x.size(); i-- > 0; ) {
+                    if( x[i] != m_modulus[i] ) return x[i] < m_modulus[i];
+                }
+                return false;
+            }
+
+            // x -= m, the borrow out of the highest coefficient is dropped
+            void SubstractModulus(Residue& x) const noexcept {
+                int borrow { 0 };
+                for(size_t i = 0; i < x.size(); i++) {
+                    x[i] -= m_modulus[i] + borrow;
+                    borrow = x[i] < 0;
+                    if( borrow ) x[i] += BigInt::RADIX;
+                }
+            }
+
+            std::vector<int> m_modulus;
+            // -m^(-1) mod RADIX
+            std::uint64_t m_inverse;
+            // R mod m, i.e. 1 in Montgomery form
+            Residue m_one;
+            // R^2 mod m
+            Residue m_square;
+        };
+
+        static BigInt PowMod(const BigInt& base, const BigInt& exponent, const BigInt& modulus) {
+            if( !modulus.IsPositive() || modulus.IsZero() ) {
+                throw std::domain_error("BigInt: modulus must be positive");
+            }
+            if( !exponent.IsPositive() ) {
+                throw std::domain_error("BigInt: negative exponent");
+            }
+            auto residue { base % modulus };
+            if( !residue.IsPositive() ) {
+                residue += modulus;
+            }
+            const auto bits { ToBinary(exponent) };
+            if( IsCoprimeToRadix(modulus) ) {
+                const Montgomery context { modulus };
+                return context.FromMontgomery(context.Power(context.ToMontgomery(residue), bits, 0u));
+            }
+            // plain square and multiply
+            BigInt result { BigInt{ 1 } % modulus };
+            ProgressScope progress { BitLength(bits) };
+            for(size_t i = BitLength(bits); i-- > 0; progress.Step()) {
+                result = KaratsubaMultiplication(result, result) % modulus;
+                if( Bit(bits, i) ) {
+                    result = KaratsubaMultiplication(result, residue) % modulus;
+                }
+            }
+            return result;
+        }
+
+        static bool IsStrongProbablePrime(const BigInt& value, const BigInt& base) {
+            if( !value.IsPositive() || !(value.m_coefficients.front() & 1) || value.CompareMagnitude(BigInt{ 3 }) <= 0 ) {
+                throw std::domain_error("BigInt: value of strong probable prime test must be odd and greater than 3");
+            }
+            // Montgomery form expects residues in [0, value)
+            auto residue { base % value };
+            if( !residue.IsPositive() ) {
+                residue += value;
+            }
+            if( residue.IsZero() ) {
+                throw std::domain_error("BigInt: base of strong probable prime test must not be divisible by value");
+            }
+            const auto minusOne { value - BigInt{ 1 } };
+            const auto bits { ToBinary(minusOne) };
+            const auto shift { TrailingZeros(bits) };
+            if( IsCoprimeToRadix(value) ) {
+                const Montgomery context { value };
+                return StrongProbablePrime(context, bits, shift, residue);
+            }
+            // value is divisible by 5: rare case, no need in Montgomery form
+            auto x { PowMod(residue, Odd(bits, shift), value) };
+            if( x == BigInt{ 1 } || x == minusOne ) {
+                return true;
+            }
+            for(size_t r = 1; r < shift; r++) {
+                x = KaratsubaMultiplication(x, x) % value;
+                if( x == minusOne ) return true;
+                if( x == BigInt{ 1 } ) return false;
+            }
+            return false;
+        }
+
+        static bool IsProbablePrime(const BigInt& value, unsigned rounds) {
+            switch( TrialDivision(value) ) {
+                case Verdict::COMPOSITE:    return false;
+                case Verdict::PRIME:        return true;
+                case Verdict::UNKNOWN:      break;
+            }
+            const Montgomery context { value };
+            const auto bits { ToBinary(value - BigInt{ 1 }) };
+            const auto shift { TrailingZeros(bits) };
+            if( !StrongProbablePrime(context, bits, shift, BigInt{ 2 }) || !StrongLucasProbablePrime(context, value) ) {
+                return false;
+            }
+            if( rounds ) {
+                // random bases in [2, value - 2]
+                thread_local std::mt19937 engine { std::random_device{}() };
+                std::uniform_int_distribution<int> coefficient { 0, BigInt::RADIX - 1 };
+                const auto range { value - BigInt{ 3 } };
+                for(unsigned i = 0; i < rounds; i++) {
+                    BigInt random;
+                    random.m_coefficients.resize(value.m_coefficients.size() + 1);
+                    for(auto& c: random.m_coefficients) {
+                        c = coefficient(engine);
+                    }
+                    if( !StrongProbablePrime(context, bits, shift, random % range + BigInt{ 2 }) ) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        static bool IsPrime(const BigInt& value) {
+            // Sorenson and Webster: no composite below passes Miller-Rabin to the first 13 prime bases
+            static const BigInt DETERMINISTIC_BOUND { "3317044064679887385961981" };
+            if( !(value < DETERMINISTIC_BOUND) ) {
+                return IsProbablePrime(value, 0);
+            }
+            switch( TrialDivision(value) ) {
+                case Verdict::COMPOSITE:    return false;
+                case Verdict::PRIME:        return true;
+                case Verdict::UNKNOWN:      break;
+            }
+            const Montgomery context { value };
+            const auto bits { ToBinary(value - BigInt{ 1 }) };
+            const auto shift { TrailingZeros(bits) };
+            for(int base: { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41 }) {
+                if( !StrongProbablePrime(context, bits, shift, BigInt{ base }) ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static BigInt NextPrime(const BigInt& value) {
+            if( value < BigInt{ 2 } ) {
+                return BigInt{ 2 };
+            }
+            auto candidate { value + BigInt{ 1 } };
+            if( !(candidate.m_coefficients.front() & 1) && candidate != BigInt{ 2 } ) {
+                candidate += BigInt{ 1 };
+            }
+            // small candidates may coincide with sieving primes
+            static const BigInt SMALL_BOUND { 1LL * SIEVE_BOUND * SIEVE_BOUND };
+            while( candidate < SMALL_BOUND ) {
+                if( IsProbablePrime(candidate, 0) ) {
+                    return candidate;
+                }
+                candidate += BigInt{ candidate == BigInt{ 2 }? 1: 2 };
+            }
+            // sieve odd numbers: candidate + 2 * i, 0 <= i < SIEVE_WINDOW
+            while( true ) {
+                std::vector<bool> isComposite (SIEVE_WINDOW, false);
+                for(const auto& [product, primes]: SmallPrimeGroups()) {
+                    const auto residue { candidate.RemainderBySmall(product) };
+                    for(auto p: primes) {
+                        if( p == 2u ) continue;
+                        // candidate + 2i = 0 (mod p) => i = -candidate / 2 (mod p)
+                        const std::uint64_t r { residue % p };
+                        for(auto i { (p - r) % p * ((p + 1) / 2) % p }; i < SIEVE_WINDOW; i += p) {
+                            isComposite[i] = true;
+                        }
+                    }
+                }
+                for(size_t i = 0; i < SIEVE_WINDOW; i++) {
+                    if( isComposite[i] ) continue;
+                    auto number { candidate + BigInt{ static_cast<long long>(2 * i) } };
+                    if( IsProbablePrime(number, 0) ) {
+                        return number;
+                    }
+                }
+                candidate += BigInt{ static_cast<long long>(2 * SIEVE_WINDOW) };
+            }
+        }
+
+    private:
+
+        enum class Verdict { COMPOSITE, PRIME, UNKNOWN };
+
+        static bool IsCoprimeToRadix(const BigInt& x) noexcept {
+            const auto lowest { x.m_coefficients.front() };
+            return (lowest & 1) && lowest % 5;
+        }
+
+        // binary representation of non-negative x: 30 bits per word, lowest word first
+        static std::vector<std::uint32_t> ToBinary(BigInt x) {
+            std::vector<std::uint32_t> words;
+            x.m_isPositive = true;
+            while( !x.IsZero() ) {
+                words.push_back(x.DivideBySmall(1u << 30));
+            }
+            return words;
+        }
+
+        static std::uint32_t Bit(const std::vector<std::uint32_t>& words, size_t i) noexcept {
+            return i / 30 < words.size()? (words[i / 30] >> (i % 30)) & 1u: 0u;
+        }
+
+        static size_t BitLength(const std::vector<std::uint32_t>& words) noexcept {
+            if( words.empty() ) return 0;
+            return (words.size() - 1) * 30 + (32 - __builtin_clz(words.back()));
+        }
+
+        static size_t TrailingZeros(const std::vector<std::uint32_t>& words) noexcept {
+            size_t zeros { 0 };
+            while( !Bit(words, zeros) && zeros < BitLength(words) ) {
+                zeros++;
+            }
+            return zeros;
+        }
+
+        // (value of words) >> shift as BigInt
+        static BigInt Odd(const std::vector<std::uint32_t>& words, size_t shift) {
+            BigInt result { 0 };
+            for(size_t i = BitLength(words); i-- > shift; ) {
+                result += result;
+                if( Bit(words, i) ) result += BigInt{ 1 };
+            }
+            return result;
+        }
+
+        /**
+         * Products of consecutive primes below SIEVE_BOUND, each product < 2^32,
+         * so the residues modulo whole group are computed by single pass.
+         */
+        static const std::vector<std::pair<std::uint32_t, std::vector<std::uint32_t>>>& SmallPrimeGroups() {
+            static const auto groups = [] {
+                std::vector<bool> isComposite (SIEVE_BOUND, false);
+                std::vector<std::pair<std::uint32_t, std::vector<std::uint32_t>>> result;
+                std::uint64_t product { 1 };
+                std::vector<std::uint32_t> primes;
+                for(std::uint32_t p = 2; p < SIEVE_BOUND; p++) {
+                    if( isComposite[p] ) continue;
+                    for(auto q { p * p }; q < SIEVE_BOUND; q += p) {
+                        isComposite[q] = true;
+                    }
+                    if( product * p >= (1ULL << 32) ) {
+                        result.emplace_back(static_cast<std::uint32_t>(product), std::move(primes));
+                        product = 1;
+                        primes.clear();
+                    }
+                    product *= p;
+                    primes.push_back(p);
+                }
+                result.emplace_back(static_cast<std::uint32_t>(product), std::move(primes));
+                return result;
+            }();
+            return groups;
+        }
+
+        static Verdict TrialDivision(const BigInt& value) {
+            if( !value.IsPositive() || value.CompareMagnitude(BigInt{ 1 }) <= 0 ) {
+                return Verdict::COMPOSITE;
+            }
+            const bool isSmall { value.m_coefficients.size() == 1u };
+            for(const auto& [product, primes]: SmallPrimeGroups()) {
+                if( primes.front() >= TRIAL_BOUND ) break;
+                const auto residue { value.RemainderBySmall(product) };
+                for(auto p: primes) {
+                    if( !(residue % p) ) {
+                        return isSmall && static_cast<std::uint32_t>(value.m_coefficients.front()) == p?
+                            Verdict::PRIME: Verdict::COMPOSITE;
+                    }
+                }
+            }
+            if( isSmall && static_cast<std::uint64_t>(value.m_coefficients.front()) < 1ULL * TRIAL_BOUND * TRIAL_BOUND ) {
+                return Verdict::PRIME;
+            }
+            return Verdict::UNKNOWN;
+        }
+
+        // value - 1 = odd * 2^shift, value - 1 is given in binary
+        static bool StrongProbablePrime(
+            const Montgomery& context,
+            const std::vector<std::uint32_t>& minusOne,
+            size_t shift,
+            const BigInt& base
+        ) {
+            const auto one { context.One() };
+            const auto negativeOne { context.Substract(context.Zero(), one) };
+            auto x { context.Power(context.ToMontgomery(base), minusOne, shift) };
+            if( x == one || x == negativeOne ) {
+                return true;
+            }
+            for(size_t r = 1; r < shift; r++) {
+                x = context.Multiply(x, x);
+                if( x == negativeOne ) return true;
+                if( x == one ) return false;
+            }
+            return false;
+        }
+
+        static int Jacobi(std::uint64_t a, std::uint64_t n) noexcept {
+            assert(n & 1u);
+            int result { 1 };
+            a %= n;
+            while( a ) {
+                while( !(a & 1u) ) {
+                    a >>= 1u;
+                    const auto r { n & 7u };
+                    if( r == 3u || r == 5u ) result = -result;
+                }
+                std::swap(a, n);
+                if( (a & 3u) == 3u && (n & 3u) == 3u ) result = -result;
+                a %= n;
+            }
+            return n == 1u? result: 0;
+        }
+
+        // Jacobi symbol (d / n) for odd d, odd n > |d|
+        static int Jacobi(long long d, const BigInt& n) {
+            // RADIX is divisible by 4
+            const auto nMod4 { n.m_coefficients.front() & 3 };
+            int result { 1 };
+            if( d < 0 ) {
+                d = -d;
+                // (-1 / n) = (-1)^((n - 1) / 2)
+                if( nMod4 == 3 ) result = -result;
+            }
+            // reciprocity: (d / n) = (n / d) * (-1)^((d - 1) / 2 * (n - 1) / 2)
+            if( (d & 3) == 3 && nMod4 == 3 ) result = -result;
+            return result * Jacobi(n.RemainderBySmall(static_cast<std::uint32_t>(d)), static_cast<std::uint64_t>(d));
+        }
+
+        /** @brief
+         * Strong Lucas probable prime test with Selfridge's parameters:
+         * D is the first of 5, -7, 9, -11, ... with (D / n) = -1, P = 1, Q = (1 - D) / 4.
+         * n + 1 = d * 2^s, d is odd; n passes if U(d) = 0 or V(d * 2^r) = 0 for some 0 <= r < s.
+         */
+        static bool StrongLucasProbablePrime(const Montgomery& context, const BigInt& n) {
+            long long d { 5 };
+            while( true ) {
+                const auto jacobi { Jacobi(d, n) };
+                if( jacobi == -1 ) break;
+                if( !jacobi ) return false; // n > |d| after trial division
+                d = d > 0? -(d + 2): -d + 2;
+                // there is no such D for squares
+                if( d == -15 && IsPerfectSquare(n) ) return false;
+            }
+            const auto q { (1 - d) / 4 };
+            const auto toMontgomery = [&context, &n](long long x) {
+                return context.ToMontgomery(x < 0? n - BigInt{ -x }: BigInt{ x });
+            };
+            const auto mD { toMontgomery(d) }, mQ { toMontgomery(q) };
+            const auto bits { ToBinary(n + BigInt{ 1 }) };
+            const auto shift { TrailingZeros(bits) };
+
+            // k = 1: U(1) = 1, V(1) = P = 1, Q^k = Q
+            auto u { context.One() }, v { context.One() }, qk { mQ };
+            for(size_t i = BitLength(bits) - 1; i-- > shift; ) {
+                // k => 2k: U(2k) = U(k) * V(k), V(2k) = V(k)^2 - 2Q^k
+                u = context.Multiply(u, v);
+                v = context.Substract(context.Multiply(v, v), context.Add(qk, qk));
+                qk = context.Multiply(qk, qk);
+                if( Bit(bits, i) ) {
+                    // k => k + 1: U(k + 1) = (P * U(k) + V(k)) / 2, V(k + 1) = (D * U(k) + P * V(k)) / 2
+                    auto nu { context.Half(context.Add(u, v)) };
+                    v = context.Half(context.Add(context.Multiply(mD, u), v));
+                    u = std::move(nu);
+                    qk = context.Multiply(qk, mQ);
+                }
+            }
+            const auto zero { context.Zero() };
+            if( u == zero || v == zero ) {
+                return true;
+            }
+            for(size_t r = 1; r < shift; r++) {
+                v = context.Substract(context.Multiply(v, v), context.Add(qk, qk));
+                if( v == zero ) return true;
+                qk = context.Multiply(qk, qk);
+            }
+            return false;
+        }
+    };
+}
+
+BigInt PowMod(const BigInt& base, const BigInt& exponent, const BigInt& modulus) {
+    return helper::Primality::PowMod(base, exponent, modulus);
+}
+
+bool IsStrongProbablePrime(const BigInt& value, const BigInt& base) {
+    return helper::Primality::IsStrongProbablePrime(value, base);
+}
+
+bool IsProbablePrime(const BigInt& value, unsigned rounds) {
+    return helper::Primality::IsProbablePrime(value, rounds);
+}
+
+bool IsPrime(const BigInt& value) {
+    return helper::Primality::IsPrime(value);
+}
+
+BigInt NextPrime(const BigInt& value) {
+    return helper::Primality::NextPrime(value);
+}
+
+std::vector<bool> AreProbablePrimes(const std::vector<BigInt>& candidates, unsigned threadCount) {
+    if( !threadCount ) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // std::vector<bool> packs bits: each thread must write its own byte
+    std::vector<char> isPrime (candidates.size(), false);
+    std::atomic<size_t> next { 0 };
+    const auto worker = [&]() {
+        for(size_t i; (i = next++) < candidates.size(); ) {
+            isPrime[i] = IsProbablePrime(candidates[i]);
+        }
+    };
+    std::vector<std::thread> threads;
+    for(unsigned i = 1; i < std::min<size_t>(threadCount, candidates.size()); i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for(auto& thread: threads) {
+        thread.join();
+    }
+    return { isPrime.cbegin(), isPrime.cend() };
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "BigInt.hpp"
+
+/**
+ * base^exponent mod modulus, 0 <= result < modulus.
+ * Moduli coprime to RADIX (i.e. to 10) use Montgomery multiplication with R = RADIX^n,
+ * other moduli are reduced by DivMod.
+ * Throws std::domain_error if modulus isn't positive or exponent is negative.
+ */
+BigInt PowMod(const BigInt& base, const BigInt& exponent, const BigInt& modulus);
+
+/**
+ * Strong probable prime test (Miller-Rabin) of odd value > 3 to the given base.
+ * The base is taken modulo value, throws std::domain_error if it's divisible by value.
+ */
+bool IsStrongProbablePrime(const BigInt& value, const BigInt& base);
+
+/**
+ * Baillie-PSW: trial division by small primes, Miller-Rabin to base 2 and
+ * strong Lucas test with Selfridge's parameters. No composite is known to pass it.
+ * @rounds additional Miller-Rabin tests to random bases.
+ */
+bool IsProbablePrime(const BigInt& value, unsigned rounds = 0);
+
+/**
+ * Deterministic for value < 3317044064679887385961981 (Miller-Rabin to the
+ * first 13 prime bases), Baillie-PSW for larger values.
+ */
+bool IsPrime(const BigInt& value);
+
+/**
+ * The smallest probable prime greater than value.
+ * Candidates are sieved by small primes in windows, survivors go to IsProbablePrime.
+ */
+BigInt NextPrime(const BigInt& value);
+
+/**
+ * IsProbablePrime for each candidate, the batch is shared between @threadCount threads
+ * (0 - std::thread::hardware_concurrency()).
+ */
+std::vector<bool> AreProbablePrimes(const std::vector<BigInt>& candidates, unsigned threadCount = 0);
@@ -0,0 +1,226 @@
+#include "ProductTree.hpp"
+#include "NumberTheory.hpp"
+#include "Parallel.hpp"
+#include <future>
+
+namespace {
+
+    BigInt Product(std::vector<BigInt>& values, size_t first, size_t last, unsigned threadCount) {
+        if( last - first == 1u ) {
+            return std::move(values[first]);
+        }
+        const auto middle { first + (last - first) / 2 };
+        if( threadCount > 1u ) {
+            auto left { std::async(std::launch::async, 
+                [&values, first, middle, threadCount]() {
+                    return Product(values, first, middle, threadCount / 2);
+                }
+            ) };
+            auto right { Product(values, middle, last, threadCount - threadCount / 2) };
+            return KaratsubaMultiplication(left.get(), right);
+        }
+        return KaratsubaMultiplication(
+            Product(values, first, middle, 1u), 
+            Product(values, middle, last, 1u)
+        );
+    }
+
+    std::vector<unsigned> Primes(unsigned bound) {
+        std::vector<bool> isComposite (bound + 1u, false);
+        std::vector<unsigned> primes;
+        for(unsigned p = 2; p <= bound; p++) {
+            if( isComposite[p] ) continue;
+            primes.push_back(p);
+            for(auto q { 1ULL * p * p }; q <= bound; q += p) {
+                isComposite[q] = true;
+            }
+        }
+        return primes;
+    }
+
+    /**
+     * Collects prime powers into factors: small ones are multiplied together 
+     * while the product fits into one coefficient of BigInt.
+     */
+    class Factors final {
+    public:
+        void Add(unsigned prime, unsigned exponent) {
+            for(unsigned i = 0; i < exponent; i++) {
+                if( m_current * prime >= RADIX ) {
+                    m_factors.emplace_back(static_cast<long long>(m_current));
+                    m_current = 1;
+                }
+                m_current *= prime;
+            }
+        }
+
+        std::vector<BigInt> Release() {
+            if( m_current > 1u ) {
+                m_factors.emplace_back(static_cast<long long>(m_current));
+                m_current = 1;
+            }
+            return std::move(m_factors);
+        }
+
+    private:
+        static constexpr std::uint64_t RADIX { 1'000'000'000 };
+
+        std::vector<BigInt> m_factors;
+        std::uint64_t m_current { 1 };
+    };
+
+    // swing(n) = n! / ((n / 2)!)^2, the exponent of prime p is sum of (n / p^i) mod 2
+    BigInt Swing(unsigned n, const std::vector<unsigned>& primes, unsigned threadCount) {
+        Factors factors;
+        for(auto p: primes) {
+            if( p > n ) break;
+            unsigned exponent { 0 };
+            for(auto q { n / p }; q; q /= p) {
+                exponent += q & 1u;
+            }
+            factors.Add(p, exponent);
+        }
+        return ProductTree(factors.Release(), threadCount);
+    }
+
+    BigInt Factorial(unsigned n, const std::vector<unsigned>& primes, unsigned threadCount) {
+        if( n < 2u ) {
+            return BigInt{ 1 };
+        }
+        if( threadCount > 1u ) {
+            // swing(n) doesn't depend on (n / 2)!
+            auto swing { std::async(std::launch::async, 
+                [n, &primes, threadCount]() {
+                    return Swing(n, primes, threadCount / 2);
+                }
+            ) };
+            const auto half { Factorial(n / 2, primes, threadCount - threadCount / 2) };
+            return KaratsubaMultiplication(KaratsubaMultiplication(half, half), swing.get());
+        }
+        const auto half { Factorial(n / 2, primes, 1u) };
+        return KaratsubaMultiplication(KaratsubaMultiplication(half, half), Swing(n, primes, 1u));
+    }
+
+    /**
+     * Levels of the product tree: the first one is moduli,
+     * the last one is their product. Odd node is moved to the next level as is.
+     */
+    std::vector<std::vector<BigInt>> SubproductTree(const std::vector<BigInt>& moduli, unsigned threadCount) {
+        for(const auto& modulus: moduli) {
+            if( !modulus.IsPositive() || modulus.IsZero() ) {
+                throw std::domain_error("BigInt: moduli must be positive");
+            }
+        }
+        std::vector<std::vector<BigInt>> tree { moduli };
+        while( tree.back().size() > 1u ) {
+            const auto& lower { tree.back() };
+            std::vector<BigInt> upper ((lower.size() + 1u) / 2u);
+            ParallelFor(upper.size(), threadCount, [&lower, &upper](size_t i) {
+                upper[i] = 2u * i + 1u < lower.size()? 
+                    KaratsubaMultiplication(lower[2u * i], lower[2u * i + 1u]): 
+                    lower[2u * i];
+            });
+            tree.push_back(std::move(upper));
+        }
+        return tree;
+    }
+
+    BigInt Modulo(const BigInt& value, const BigInt& modulus) {
+        auto residue { value % modulus };
+        if( !residue.IsPositive() ) {
+            residue += modulus;
+        }
+        return residue;
+    }
+}
+
+BigInt ProductTree(std::vector<BigInt> values, unsigned threadCount) {
+    if( values.empty() ) {
+        return BigInt{ 1 };
+    }
+    return Product(values, 0u, values.size(), std::max(threadCount, 1u));
+}
+
+BigInt Factorial(unsigned n, unsigned threadCount) {
+    return Factorial(n, Primes(n), threadCount);
+}
+
+BigInt Binomial(unsigned n, unsigned k, unsigned threadCount) {
+    if( k > n ) {
+        return BigInt{ 0 };
+    }
+    // Kummer: the exponent of prime p is the number of borrows in n - k in base p
+    Factors factors;
+    for(auto p: Primes(n)) {
+        unsigned exponent { 0 };
+        for(auto q { 1ULL * p }; q <= n; q *= p) {
+            exponent += static_cast<unsigned>(n / q - k / q - (n - k) / q);
+        }
+        factors.Add(p, exponent);
+    }
+    return ProductTree(factors.Release(), threadCount);
+}
+
+std::vector<BigInt> RemainderTree(const BigInt& value, const std::vector<BigInt>& moduli, unsigned threadCount) {
+    if( moduli.empty() ) {
+        return {};
+    }
+    const auto tree { SubproductTree(moduli, threadCount) };
+    std::vector<BigInt> residues { Modulo(value, tree.back().front()) };
+    for(size_t level = tree.size() - 1u; level-- > 0; ) {
+        const auto& nodes { tree[level] };
+        std::vector<BigInt> lower (nodes.size());
+        ParallelFor(nodes.size(), threadCount, [&nodes, &residues, &lower](size_t i) {
+            // residues are non-negative already
+            lower[i] = residues[i / 2u] % nodes[i];
+        });
+        residues = std::move(lower);
+    }
+    return residues;
+}
+
+BigInt ChineseRemainder(const std::vector<BigInt>& residues, const std::vector<BigInt>& moduli, unsigned threadCount) {
+    if( residues.size() != moduli.size() ) {
+        throw std::domain_error("BigInt: numbers of residues and moduli differ");
+    }
+    if( moduli.empty() ) {
+        return BigInt{ 0 };
+    }
+    const auto tree { SubproductTree(moduli, threadCount) };
+    // (M / m) mod m for each node m: (M / L) mod L = ((M / P) mod P) * R mod L,
+    // where L and R are children of P
+    std::vector<BigInt> cofactors { BigInt{ 1 } % tree.back().front() };
+    for(size_t level = tree.size() - 1u; level-- > 0; ) {
+        const auto& nodes { tree[level] };
+        std::vector<BigInt> lower (nodes.size());
+        ParallelFor(nodes.size(), threadCount, [&nodes, &cofactors, &lower](size_t i) {
+            const auto sibling { i ^ 1u };
+            lower[i] = sibling < nodes.size()? 
+                KaratsubaMultiplication(cofactors[i / 2u], nodes[sibling]) % nodes[i]:
+                cofactors[i / 2u];
+        });
+        cofactors = std::move(lower);
+    }
+    // x = sum of residue * ((M / m)^-1 mod m) * (M / m), the first factors are the leaves' terms
+    std::vector<BigInt> terms (moduli.size());
+    ParallelFor(moduli.size(), threadCount, [&residues, &moduli, &cofactors, &terms](size_t i) {
+        auto [gcd, inverse, unused] = ExtendedGcd(cofactors[i], moduli[i]);
+        (void)unused;
+        if( gcd != BigInt{ 1 } ) {
+            throw std::domain_error("BigInt: moduli must be pairwise coprime");
+        }
+        terms[i] = Modulo(KaratsubaMultiplication(Modulo(residues[i], moduli[i]), inverse), moduli[i]);
+    });
+    for(size_t level = 0; level + 1u < tree.size(); level++) {
+        const auto& nodes { tree[level] };
+        std::vector<BigInt> upper ((nodes.size() + 1u) / 2u);
+        ParallelFor(upper.size(), threadCount, [&nodes, &terms, &upper](size_t i) {
+            upper[i] = 2u * i + 1u < nodes.size()? 
+                KaratsubaMultiplication(terms[2u * i], nodes[2u * i + 1u]) + KaratsubaMultiplication(terms[2u * i + 1u], nodes[2u * i]):
+                std::move(terms[2u * i]);
+        });
+        terms = std::move(upper);
+    }
+    // the sum is less than M times the number of moduli
+    return Modulo(terms.front(), tree.back().front());
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "BigInt.hpp"
+
+/**
+ * Product of all values multiplied in balanced binary-tree order,
+ * so operands on each level have similar sizes and KaratsubaMultiplication pays off
+ * (unlike accumulating a huge product by small factors one by one).
+ * The halves of the tree are multiplied by up to @threadCount threads.
+ * Product of no values is 1.
+ */
+BigInt ProductTree(std::vector<BigInt> values, unsigned threadCount = 1);
+
+/**
+ * n! by prime-swing algorithm: n! = ((n / 2)!)^2 * swing(n),
+ * where swing(n) = n! / ((n / 2)!)^2 is assembled from prime powers by ProductTree.
+ */
+BigInt Factorial(unsigned n, unsigned threadCount = 1);
+
+/**
+ * Binomial coefficient C(n, k) assembled from its prime factorization (Kummer's theorem)
+ * by ProductTree, 0 if k > n.
+ */
+BigInt Binomial(unsigned n, unsigned k, unsigned threadCount = 1);
+
+/**
+ * Residues of value modulo each of moduli, 0 <= result[i] < moduli[i].
+ * The value is reduced modulo the product of all moduli and then modulo the nodes
+ * of their product tree down to the leaves, so each DivMod has operands of similar sizes
+ * instead of dividing the whole value by every modulus.
+ * Nodes of each level are processed by up to @threadCount threads.
+ * Throws std::domain_error if a modulus isn't positive.
+ */
+std::vector<BigInt> RemainderTree(const BigInt& value, const std::vector<BigInt>& moduli, unsigned threadCount = 1);
+
+/**
+ * x, 0 <= x < M, such that x = residues[i] (mod moduli[i]), M - product of moduli.
+ * (M / m) mod m is found for each node m of the product tree from the root down,
+ * the leaves' terms are combined up the tree: x = x_L * R + x_R * L for children L and R.
+ * Nodes of each level are processed by up to @threadCount threads.
+ * Throws std::domain_error if moduli aren't positive and pairwise coprime
+ * or the sizes of residues and moduli differ.
+ */
+BigInt ChineseRemainder(const std::vector<BigInt>& residues, const std::vector<BigInt>& moduli, unsigned threadCount = 1);
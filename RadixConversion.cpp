@@ -0,0 +1,278 @@
+#include "RadixConversion.hpp"
+#include "Async.hpp"
+#include <array>
+
+namespace helper {
+
+    /**
+     * Friend class of BigInt: chunks are accumulated into and extracted from coefficients directly.
+     */
+    class Radix final {
+    public:
+
+        using Chunks = std::vector<std::uint32_t>;
+
+        /**
+         * Chunks of |value| in @base, from the lowest one, without leading zero chunks.
+         */
+        static Chunks ToChunks(const BigInt& value, std::uint32_t base) {
+            if( value.IsZero() ) {
+                return {};
+            }
+            auto magnitude { value };
+            magnitude.m_isPositive = true;
+            // magnitude < base^(2^j) for the last power
+            std::vector<BigInt> powers { BigInt{ base } };
+            while( powers.back().CompareMagnitude(magnitude) <= 0 ) {
+                powers.push_back(KaratsubaMultiplication(powers.back(), powers.back()));
+            }
+            Chunks chunks(size_t{ 1 } << (powers.size() - 1));
+            Split(std::move(magnitude), powers.size() - 1, powers, base, chunks.data());
+            while( !chunks.empty() && !chunks.back() ) {
+                chunks.pop_back();
+            }
+            return chunks;
+        }
+
+        /**
+         * Value of @count chunks in @base, from the lowest one.
+         */
+        static BigInt FromChunks(const std::uint32_t* chunks, size_t count, std::uint32_t base) {
+            if( !count ) {
+                return BigInt{};
+            }
+            // powers[j] = base^(2^j) for all 2^j < count
+            std::vector<BigInt> powers { BigInt{ base } };
+            while( (size_t{ 1 } << powers.size()) < count ) {
+                powers.push_back(KaratsubaMultiplication(powers.back(), powers.back()));
+            }
+            return Join(chunks, count, powers, base);
+        }
+
+    private:
+
+        // shorter numbers of chunks are converted by single-coefficient operations, O(n^2)
+        static constexpr size_t CONVERSION_THRESHOLD = 32;
+
+        /**
+         * Writes 2^j chunks of value < base^(2^j): value = high * base^(2^(j - 1)) + low.
+         */
+        static void Split(BigInt value, size_t j, const std::vector<BigInt>& powers, std::uint32_t base, std::uint32_t* chunks) {
+            const auto count { size_t{ 1 } << j };
+            if( count <= CONVERSION_THRESHOLD ) {
+                for(size_t i = 0; i < count; i++) {
+                    chunks[i] = value.IsZero()? 0: value.DivideBySmall(base);
+                }
+                return;
+            }
+            ProgressScope progress { 2 };
+            auto [high, low] = value.DivMod(powers[j - 1]);
+            Split(std::move(low), j - 1, powers, base, chunks);
+            progress.Step();
+            Split(std::move(high), j - 1, powers, base, chunks + count / 2);
+            progress.Step();
+        }
+
+        /**
+         * Value of chunks[0..count): high * base^(2^j) + low for the largest 2^j < count.
+         */
+        static BigInt Join(const std::uint32_t* chunks, size_t count, const std::vector<BigInt>& powers, std::uint32_t base) {
+            if( count <= CONVERSION_THRESHOLD ) {
+                // Horner's scheme, limb * base + carry < RADIX * 2^31 + 2^32 fits into 64 bits
+                BigInt value;
+                auto& coefficients { value.m_coefficients };
+                for(size_t i = count; i-- > 0; ) {
+                    std::uint64_t carry { chunks[i] };
+                    for(auto& coefficient: coefficients) {
+                        const auto current { 1ULL * static_cast<std::uint32_t>(coefficient) * base + carry };
+                        coefficient = static_cast<int>(current % BigInt::RADIX);
+                        carry = current / BigInt::RADIX;
+                    }
+                    for(; carry; carry /= BigInt::RADIX) {
+                        coefficients.push_back(static_cast<int>(carry % BigInt::RADIX));
+                    }
+                }
+                return value;
+            }
+            size_t j { 0 };
+            while( (size_t{ 2 } << j) < count ) {
+                j++;
+            }
+            const auto half { size_t{ 1 } << j };
+            ProgressScope progress { 2 };
+            auto value { Join(chunks + half, count - half, powers, base) };
+            value *= powers[j];
+            progress.Step();
+            value += Join(chunks, half, powers, base);
+            progress.Step();
+            return value;
+        }
+    };
+}
+
+namespace {
+
+    constexpr unsigned MIN_RADIX = 2;
+    constexpr unsigned MAX_RADIX = 36;
+    constexpr std::uint32_t BYTE_CHUNK_BASE = 1u << 24;
+    constexpr char DIGITS[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+    // value of a digit character or MAX_RADIX for other characters
+    constexpr std::array<std::uint8_t, 256> DIGIT_VALUES = []() {
+        std::array<std::uint8_t, 256> values {};
+        for(auto& value: values) {
+            value = MAX_RADIX;
+        }
+        for(unsigned digit = 0; digit < MAX_RADIX; digit++) {
+            values[static_cast<std::uint8_t>(DIGITS[digit])] = static_cast<std::uint8_t>(digit);
+            if( digit >= 10 ) {
+                values[static_cast<std::uint8_t>(DIGITS[digit] - 'a' + 'A')] = static_cast<std::uint8_t>(digit);
+            }
+        }
+        return values;
+    }();
+
+    // two hexadecimal digits of each byte
+    constexpr std::array<char, 512> HEX_PAIRS = []() {
+        std::array<char, 512> pairs {};
+        for(unsigned byte = 0; byte < 256; byte++) {
+            pairs[2 * byte] = DIGITS[byte >> 4];
+            pairs[2 * byte + 1] = DIGITS[byte & 15];
+        }
+        return pairs;
+    }();
+
+    /**
+     * The largest power radix^k < 2^31 and k, chunks of k digits are converted at once.
+     */
+    std::pair<std::uint32_t, size_t> ChunkBase(unsigned radix) {
+        if( radix < MIN_RADIX || radix > MAX_RADIX ) {
+            throw std::domain_error("BigInt: radix must be in [2, 36]");
+        }
+        std::uint32_t base { radix };
+        size_t width { 1 };
+        while( 1ULL * base * radix < (1ULL << 31) ) {
+            base *= radix;
+            width++;
+        }
+        return { base, width };
+    }
+
+    /**
+     * Removes the sign of the text, returns whether it's negative.
+     */
+    bool RemoveSign(std::string_view& text) {
+        const bool isNegative { !text.empty() && text.front() == '-' };
+        if( !text.empty() && (text.front() == '-' || text.front() == '+') ) {
+            text.remove_prefix(1);
+        }
+        return isNegative;
+    }
+
+    BigInt Signed(BigInt value, bool isNegative) {
+        if( isNegative && !value.IsZero() ) {
+            -value;
+        }
+        return value;
+    }
+}
+
+std::vector<std::uint8_t> ToBytes(const BigInt& value) {
+    const auto chunks { helper::Radix::ToChunks(value, BYTE_CHUNK_BASE) };
+    std::vector<std::uint8_t> bytes;
+    bytes.reserve(3 * chunks.size());
+    for(auto chunk { chunks.crbegin() }; chunk != chunks.crend(); ++chunk) {
+        for(int shift = 16; shift >= 0; shift -= 8) {
+            const auto byte { static_cast<std::uint8_t>(*chunk >> shift) };
+            if( byte || !bytes.empty() ) {
+                bytes.push_back(byte);
+            }
+        }
+    }
+    return bytes;
+}
+
+BigInt FromBytes(const std::uint8_t* data, size_t size) {
+    // chunks of three bytes from the lowest one
+    std::vector<std::uint32_t> chunks((size + 2) / 3);
+    for(size_t i = 0; i < size; i++) {
+        const auto position { size - 1 - i };
+        chunks[i / 3] |= static_cast<std::uint32_t>(data[position]) << (8 * (i % 3));
+    }
+    return helper::Radix::FromChunks(chunks.data(), chunks.size(), BYTE_CHUNK_BASE);
+}
+
+std::string ToHex(const BigInt& value) {
+    const auto bytes { ToBytes(value) };
+    if( bytes.empty() ) {
+        return "0";
+    }
+    std::string text(2 * bytes.size(), '0');
+    for(size_t i = 0; i < bytes.size(); i++) {
+        text[2 * i] = HEX_PAIRS[2 * bytes[i]];
+        text[2 * i + 1] = HEX_PAIRS[2 * bytes[i] + 1];
+    }
+    if( text.front() == '0' ) {
+        text.erase(0, 1);
+    }
+    if( !value.IsPositive() ) {
+        text.insert(0, 1, '-');
+    }
+    return text;
+}
+
+BigInt FromHex(std::string_view text) {
+    const bool isNegative { RemoveSign(text) };
+    if( text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X') ) {
+        text.remove_prefix(2);
+    }
+    if( !text.empty() && (text.front() == '-' || text.front() == '+') ) {
+        throw std::domain_error("BigInt: invalid digit");
+    }
+    return Signed(FromRadixString(text, 16), isNegative);
+}
+
+std::string ToRadixString(const BigInt& value, unsigned radix) {
+    const auto [base, width] = ChunkBase(radix);
+    const auto chunks { helper::Radix::ToChunks(value, base) };
+    if( chunks.empty() ) {
+        return "0";
+    }
+    std::string text(width * chunks.size(), '0');
+    for(size_t i = 0; i < chunks.size(); i++) {
+        // the chunk's digits from the lowest one
+        auto chunk { chunks[i] };
+        for(size_t position = text.size() - width * i; chunk; chunk /= radix) {
+            text[--position] = DIGITS[chunk % radix];
+        }
+    }
+    text.erase(0, text.find_first_not_of('0'));
+    if( !value.IsPositive() ) {
+        text.insert(0, 1, '-');
+    }
+    return text;
+}
+
+BigInt FromRadixString(std::string_view text, unsigned radix) {
+    const auto [base, width] = ChunkBase(radix);
+    const bool isNegative { RemoveSign(text) };
+    if( text.empty() ) {
+        throw std::domain_error("BigInt: no digits");
+    }
+    // chunks of width digits from the lowest one
+    std::vector<std::uint32_t> chunks((text.size() + width - 1) / width);
+    for(size_t i = 0; i < chunks.size(); i++) {
+        const auto last { text.size() - width * i };
+        const auto first { last > width? last - width: 0 };
+        std::uint32_t chunk { 0 };
+        for(auto position = first; position < last; position++) {
+            const auto digit { DIGIT_VALUES[static_cast<std::uint8_t>(text[position])] };
+            if( digit >= radix ) {
+                throw std::domain_error("BigInt: invalid digit");
+            }
+            chunk = chunk * radix + digit;
+        }
+        chunks[i] = chunk;
+    }
+    return Signed(helper::Radix::FromChunks(chunks.data(), chunks.size(), base), isNegative);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "BigInt.hpp"
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Conversions between BigInt's base 10^9 coefficients and other radices.
+ * The value is split into "chunks" in base B = radix^k (B < 2^31) by divide and conquer:
+ * x = high * B^(2^j) + low, both halves are converted recursively, so the work is done
+ * by the subquadratic multiplication and division instead of O(n^2) digit-by-digit loops.
+ * Short values are converted by single-coefficient operations.
+ */
+
+/**
+ * Absolute value as big-endian bytes without leading zero bytes, zero is empty.
+ */
+std::vector<std::uint8_t> ToBytes(const BigInt& value);
+
+/**
+ * Non-negative value of big-endian bytes.
+ */
+BigInt FromBytes(const std::uint8_t* data, size_t size);
+
+inline BigInt FromBytes(const std::vector<std::uint8_t>& bytes) {
+    return FromBytes(bytes.data(), bytes.size());
+}
+
+/**
+ * Lowercase hexadecimal digits without leading zeros, "-" for negative values, "0" for zero.
+ * The bytes are formatted by a table of digit pairs.
+ */
+std::string ToHex(const BigInt& value);
+
+/**
+ * Parses "[-+][0x]hexdigits", both cases of digits are accepted.
+ * Throws std::domain_error if there are no digits or a character isn't a digit.
+ */
+BigInt FromHex(std::string_view text);
+
+/**
+ * Digits 0-9a-z of the value in @radix, "-" for negative values.
+ * Throws std::domain_error if radix isn't in [2, 36].
+ */
+std::string ToRadixString(const BigInt& value, unsigned radix);
+
+/**
+ * Parses "[-+]digits" in @radix, both cases of letters are accepted.
+ * Throws std::domain_error if radix isn't in [2, 36], there are no digits or a character isn't a digit.
+ */
+BigInt FromRadixString(std::string_view text, unsigned radix);
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "BigInt.hpp"
+#include <atomic>
+#include <utility>
+
+/**
+ * Handle to reference-counted BigInt with copy-on-write:
+ * copies share the coefficients (O(1), atomic reference counter with acquire/release
+ * ordering, so the uniqueness check of copy-on-write is safe between threads),
+ * the value is cloned by the first modification while it's shared.
+ * Meant for large read-mostly values (moduli, precomputed powers)
+ * passed around by value or between threads.
+ * @note
+ * Like with std::shared_ptr, distinct handles may be used by different threads,
+ * one handle mustn't be modified by one thread while being read by another.
+ */
+class SharedBigInt final {
+public:
+
+    SharedBigInt(BigInt value = BigInt{}) :
+        m_node { new Node{ std::move(value) } }
+    {
+    }
+
+    SharedBigInt(const SharedBigInt& other) noexcept :
+        m_node { other.m_node }
+    {
+        // a new reference is made from an existing one, no ordering needed
+        m_node->count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * The moved-from handle is left holding zero, like a default constructed one.
+     */
+    SharedBigInt(SharedBigInt&& other) :
+        m_node { std::exchange(other.m_node, new Node{ BigInt{} }) }
+    {
+    }
+
+    SharedBigInt& operator=(SharedBigInt other) noexcept {
+        std::swap(m_node, other.m_node);
+        return *this;
+    }
+
+    ~SharedBigInt() {
+        this->Release();
+    }
+
+    const BigInt& Get() const noexcept {
+        return m_node->value;
+    }
+
+    operator const BigInt& () const noexcept {
+        return m_node->value;
+    }
+
+    /**
+     * The value for modification, cloned first if other handles share it.
+     * The reference is invalidated by copying the handle.
+     */
+    BigInt& Mutable() {
+        if( this->IsShared() ) {
+            auto clone { new Node{ m_node->value } };
+            this->Release();
+            m_node = clone;
+        }
+        return m_node->value;
+    }
+
+    /**
+     * Acquire load: it synchronizes with the release decrements of the handles dropped by other threads,
+     * so their reads of the value happen before a modification of the unique handle.
+     */
+    bool IsShared() const noexcept {
+        return m_node->count.load(std::memory_order_acquire) > 1;
+    }
+
+    void operator += (const BigInt& rhs) {
+        this->Mutable() += rhs;
+    }
+
+    void operator -= (const BigInt& rhs) {
+        this->Mutable() -= rhs;
+    }
+
+    void operator *= (const BigInt& rhs) {
+        this->Mutable() *= rhs;
+    }
+
+    void operator /= (const BigInt& rhs) {
+        this->Mutable() /= rhs;
+    }
+
+    void operator %= (const BigInt& rhs) {
+        this->Mutable() %= rhs;
+    }
+
+private:
+
+    struct Node {
+        explicit Node(BigInt x) :
+            value { std::move(x) }
+        {
+        }
+
+        std::atomic<size_t> count { 1 };
+        BigInt value;
+    };
+
+    void Release() noexcept {
+        if( m_node->count.fetch_sub(1, std::memory_order_release) == 1 ) {
+            // the reads by the other released handles happen before the deletion
+            std::atomic_thread_fence(std::memory_order_acquire);
+            delete m_node;
+        }
+    }
+
+    Node* m_node;
+};
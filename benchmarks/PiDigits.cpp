@@ -0,0 +1,23 @@
+#include "../BigFloat.hpp"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/**
+ * Computes decimal digits of pi, 1'000'000 by default:
+ * PiDigits [digits]
+ */
+int main(int argc, char* argv[]) {
+    const size_t digits { argc > 1? std::stoul(argv[1]): 1'000'000 };
+    const auto start { std::chrono::steady_clock::now() };
+    const auto pi { Pi(BigFloat::PrecisionForDigits(digits)) };
+    const std::chrono::duration<double> elapsed { std::chrono::steady_clock::now() - start };
+
+    std::ostringstream os;
+    os << pi;
+    const auto text { os.str().substr(0, digits + 2) };
+    std::cout << digits << " digits of pi in " << elapsed.count() << " s\n"
+              << text.substr(0, 50) << "..." << text.substr(text.size() - std::min<size_t>(50, text.size())) << '\n';
+    return 0;
+}
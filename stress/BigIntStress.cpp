@@ -0,0 +1,345 @@
+#include "../BigIntAccumulator.hpp"
+#include "../NumberTheory.hpp"
+#include "../Parallel.hpp"
+#include "../ProductTree.hpp"
+#include "../RadixConversion.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+
+/**
+ * Randomized differential testing of BigInt's tiers:
+ * BigIntStress [--seconds 10] [--seed time] [--max-limbs 2048]
+ * Operands of sampled sizes and shapes are multiplied by every tier and compared with
+ * a reference school-like multiplication on decimal digits, divisions are checked
+ * against quotients and reminders known in advance, other operations by identities.
+ * The first mismatch is printed with the seed that reproduces it, the exit code is 1.
+ */
+
+namespace {
+
+    using Limbs = std::vector<std::uint64_t>;
+
+    constexpr std::uint64_t RADIX = 1'000'000'000;
+    // sizes around the thresholds of the tiers, the largest ones switch DivMod to Newton's division
+    constexpr size_t THRESHOLDS[] = { 24, 48, 256, 1024 };
+
+    enum class Shape { Random, AllMax, Sparse, PowerOfRadix, Extremes };
+
+    struct Operand {
+        std::string text;
+        BigInt value;
+    };
+
+    struct Failure {
+        std::string check;
+    };
+
+    std::string ToString(const BigInt& value) {
+        std::ostringstream os;
+        os << value;
+        return os.str();
+    }
+
+    std::string ToString(const Limbs& limbs, bool isNegative) {
+        std::ostringstream os;
+        if( isNegative ) {
+            os << '-';
+        }
+        os << limbs.back();
+        for(auto limb { limbs.crbegin() + 1 }; limb != limbs.crend(); ++limb) {
+            os.width(9);
+            os.fill('0');
+            os << *limb;
+        }
+        return os.str();
+    }
+
+    /**
+     * Little-endian base 10^9 limbs of the decimal text, independent of BigInt's parser.
+     */
+    Limbs ToLimbs(std::string_view text) {
+        if( text.front() == '-' ) {
+            text.remove_prefix(1);
+        }
+        Limbs limbs;
+        for(auto last { text.size() }; last > 0; last = last > 9? last - 9: 0) {
+            const auto first { last > 9? last - 9: 0 };
+            limbs.push_back(std::stoull(std::string{ text.substr(first, last - first) }));
+        }
+        return limbs;
+    }
+
+    /**
+     * The reference product of decimal texts, O(n*m).
+     */
+    std::string ReferenceProduct(const std::string& lhs, const std::string& rhs) {
+        const auto a { ToLimbs(lhs) };
+        const auto b { ToLimbs(rhs) };
+        Limbs product(a.size() + b.size(), 0);
+        for(size_t i = 0; i < a.size(); i++) {
+            std::uint64_t carry { 0 };
+            for(size_t j = 0; j < b.size(); j++) {
+                const auto current { product[i + j] + a[i] * b[j] + carry };
+                product[i + j] = current % RADIX;
+                carry = current / RADIX;
+            }
+            product[i + b.size()] = carry;
+        }
+        while( product.size() > 1u && !product.back() ) {
+            product.pop_back();
+        }
+        const bool isNegative { (lhs.front() == '-') != (rhs.front() == '-') && product.back() };
+        return ToString(product, isNegative);
+    }
+
+    class Generator final {
+    public:
+
+        Generator(std::uint64_t seed, size_t maxLimbs) :
+            m_generator { seed },
+            m_maxLimbs { maxLimbs }
+        {
+        }
+
+        /**
+         * Number of limbs: log-uniform in [1, maxLimbs] or close to a threshold of the tiers.
+         */
+        size_t Size() {
+            if( Chance(2) ) {
+                const auto threshold { THRESHOLDS[Uniform(std::size(THRESHOLDS))] };
+                return std::clamp<size_t>(threshold + Uniform(9) - 4, 1, m_maxLimbs);
+            }
+            const auto bits { std::uniform_real_distribution<double>{ 0, std::log2(static_cast<double>(m_maxLimbs)) }(m_generator) };
+            return std::clamp<size_t>(static_cast<size_t>(std::exp2(bits)), 1, m_maxLimbs);
+        }
+
+        /**
+         * Positive operand of @size limbs (zero for no limbs).
+         */
+        Operand Magnitude(size_t size) {
+            if( !size ) {
+                return { "0", BigInt{} };
+            }
+            Limbs limbs(size, 0);
+            switch( static_cast<Shape>(Uniform(5)) ) {
+                case Shape::Random:
+                    for(auto& limb: limbs) {
+                        limb = Limb();
+                    }
+                    break;
+                case Shape::AllMax:
+                    limbs.assign(size, RADIX - 1);
+                    break;
+                case Shape::Sparse:
+                    for(size_t i = 0; i < 3; i++) {
+                        limbs[Uniform(size)] = Limb();
+                    }
+                    break;
+                case Shape::PowerOfRadix:
+                    break;
+                case Shape::Extremes:
+                    for(auto& limb: limbs) {
+                        limb = Chance(2)? RADIX - 1: 0;
+                    }
+                    break;
+            }
+            limbs.back() = std::max<std::uint64_t>(limbs.back(), 1);
+            const auto text { ToString(limbs, false) };
+            return { text, BigInt{ text } };
+        }
+
+        /**
+         * Operand of @size limbs with a random sign, zero is positive.
+         */
+        Operand Signed(size_t size) {
+            return Chance(2)? Negated(Magnitude(size)): Magnitude(size);
+        }
+
+        bool Chance(size_t outOf) {
+            return !Uniform(outOf);
+        }
+
+        size_t Uniform(size_t count) {
+            return std::uniform_int_distribution<size_t>{ 0, count - 1 }(m_generator);
+        }
+
+        static Operand Negated(Operand operand) {
+            if( operand.text == "0" ) {
+                return operand;
+            }
+            if( operand.text.front() == '-' ) {
+                operand.text.erase(0, 1);
+            }
+            else {
+                operand.text.insert(0, 1, '-');
+            }
+            operand.value = BigInt{ operand.text };
+            return operand;
+        }
+
+    private:
+
+        std::uint64_t Limb() {
+            return std::uniform_int_distribution<std::uint64_t>{ 0, RADIX - 1 }(m_generator);
+        }
+
+        std::mt19937_64 m_generator;
+        size_t m_maxLimbs;
+    };
+
+    void Check(bool isPassed, const char* check) {
+        if( !isPassed ) {
+            throw Failure{ check };
+        }
+    }
+
+    /**
+     * Every multiplication tier against the reference product.
+     */
+    void CheckProduct(const Operand& lhs, const Operand& rhs) {
+        const auto expected { ReferenceProduct(lhs.text, rhs.text) };
+        Check(ToString(lhs.value * rhs.value) == expected, "operator*");
+        auto product { lhs.value };
+        product *= rhs.value;
+        Check(ToString(product) == expected, "operator*=");
+        Check(ToString(KaratsubaMultiplication(lhs.value, rhs.value)) == expected, "KaratsubaMultiplication");
+        product = rhs.value;
+        Multiply(product, lhs.value, product);
+        Check(ToString(product) == expected, "Multiply into an operand");
+        auto accumulator { lhs.value };
+        AddMultiply(accumulator, lhs.value, rhs.value);
+        Check(accumulator - lhs.value == product, "AddMultiply");
+        SubstractMultiply(accumulator, lhs.value, rhs.value);
+        Check(accumulator == lhs.value, "SubstractMultiply");
+        Check(ToString(ProductTree({ lhs.value, rhs.value })) == expected, "ProductTree");
+    }
+
+    /**
+     * Dividend = quotient * divisor + reminder for a known quotient and reminder,
+     * the reminder is shorter than the divisor and has the sign of the dividend.
+     */
+    void CheckDivision(Generator& generator, const Operand& divisor) {
+        if( divisor.value.IsZero() ) {
+            return;
+        }
+        const bool isNegative { generator.Chance(2) };
+        const bool isDivisorNegative { divisor.text.front() == '-' };
+        auto quotient { generator.Magnitude(generator.Size()) };
+        if( isNegative != isDivisorNegative ) {
+            quotient = Generator::Negated(quotient);
+        }
+        auto reminder { generator.Magnitude(generator.Uniform(ToLimbs(divisor.text).size())) };
+        if( isNegative ) {
+            reminder = Generator::Negated(reminder);
+        }
+        const auto dividend { BigInt{ ReferenceProduct(quotient.text, divisor.text) } + reminder.value };
+
+        const auto div { dividend / divisor.value };
+        const auto mod { dividend % divisor.value };
+        Check(ToString(div) == quotient.text, "operator/");
+        Check(ToString(mod) == reminder.text, "operator%");
+        Check(div * divisor.value + mod == dividend, "(a / b) * b + a % b == a");
+    }
+
+    /**
+     * Identities between the other operations.
+     */
+    void CheckIdentities(Generator& generator, const Operand& lhs, const Operand& rhs) {
+        const auto& a { lhs.value };
+        const auto& b { rhs.value };
+        const auto sum { a + b };
+        Check(sum - b == a, "(a + b) - b == a");
+        Check(a - b == BigInt{} - (b - a), "a - b == -(b - a)");
+        Check(ParallelAdd(a, b, 3) == sum, "ParallelAdd");
+        Check(ParallelSubstract(sum, b, 3) == a, "ParallelSubstract");
+        BigIntAccumulator accumulator { a };
+        accumulator += b;
+        accumulator -= b;
+        accumulator -= b;
+        Check(accumulator.Value() == a - b, "BigIntAccumulator");
+
+        Check(Compare(a, b) == -Compare(b, a), "Compare(a, b) == -Compare(b, a)");
+        Check((Compare(a, b) < 0) == (a < b) && (Compare(a, b) == 0) == (a == b), "relational operators");
+        Check(std::hash<BigInt>{}(sum - b) == std::hash<BigInt>{}(a), "std::hash");
+        Check(BigInt{ ToString(a) } == a, "decimal round trip");
+        Check(FromHex(ToHex(a)) == a, "hexadecimal round trip");
+        const auto radix { static_cast<unsigned>(2 + generator.Uniform(35)) };
+        Check(FromRadixString(ToRadixString(b, radix), radix) == b, "radix round trip");
+
+        const auto gcd { Gcd(a, b) };
+        Check(gcd.IsZero()? a.IsZero() && b.IsZero(): (a % gcd).IsZero() && (b % gcd).IsZero(), "Gcd divides operands");
+        if( a.IsPositive() ) {
+            const auto root { IntegerSqrt(a) };
+            const auto next { root + BigInt{ 1 } };
+            Check(root * root <= a && a < next * next, "IntegerSqrt");
+        }
+    }
+
+    void PrintUsage() {
+        std::cerr << "BigIntStress [--seconds 10] [--seed time] [--max-limbs 2048]\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    double seconds { 10 };
+    std::uint64_t seed { static_cast<std::uint64_t>(std::chrono::system_clock::now().time_since_epoch().count()) };
+    size_t maxLimbs { 2048 };
+    for(int i = 1; i < argc; i++) {
+        const std::string option { argv[i] };
+        if( i + 1 == argc ) {
+            PrintUsage();
+            return 2;
+        }
+        const std::string value { argv[++i] };
+        if( option == "--seconds" ) {
+            seconds = std::stod(value);
+        }
+        else if( option == "--seed" ) {
+            seed = std::stoull(value);
+        }
+        else if( option == "--max-limbs" ) {
+            maxLimbs = std::max<size_t>(std::stoul(value), 1);
+        }
+        else {
+            PrintUsage();
+            return 2;
+        }
+    }
+    std::cout << "BigIntStress --seconds " << seconds << " --seed " << seed << " --max-limbs " << maxLimbs << std::endl;
+
+    Generator generator { seed, maxLimbs };
+    const auto start { std::chrono::steady_clock::now() };
+    const std::chrono::duration<double> budget { seconds };
+    size_t iteration { 0 };
+    for(; std::chrono::steady_clock::now() - start < budget; iteration++) {
+        auto lhs { generator.Signed(generator.Size()) };
+        auto rhs { generator.Signed(generator.Chance(8)? 0: generator.Size()) };
+        if( generator.Chance(2) ) {
+            std::swap(lhs, rhs);
+        }
+        try {
+            CheckProduct(lhs, rhs);
+            CheckDivision(generator, rhs);
+            CheckIdentities(generator, lhs, rhs);
+        }
+        catch(const Failure& failure) {
+            std::cerr << "FAILED " << failure.check << " at iteration " << iteration
+                      << "\nlhs = " << lhs.text << "\nrhs = " << rhs.text << '\n';
+            return 1;
+        }
+        catch(const std::exception& exception) {
+            // std::logic_error of the BIGINT_VERIFY build
+            std::cerr << "FAILED with exception: " << exception.what() << " at iteration " << iteration
+                      << "\nlhs = " << lhs.text << "\nrhs = " << rhs.text << '\n';
+            return 1;
+        }
+    }
+    std::cout << iteration << " iterations passed" << std::endl;
+    return 0;
+}
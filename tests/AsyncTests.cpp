@@ -0,0 +1,157 @@
+#include "../Async.hpp"
+#include "../Primality.hpp"
+#include "../RadixConversion.hpp"
+#include "TestUtilities.hpp"
+#include <gtest/gtest.h>
+
+namespace {
+    AsyncOptions Inline() {
+        AsyncOptions options;
+        options.executor = InlineExecutor;
+        return options;
+    }
+}
+
+TEST(AsyncTest, HugeProductsAreSplit)
+{
+    std::mt19937 generator { 5 };
+    // balanced operands go by Karatsuba's step, unbalanced ones by blocks
+    const auto a { RandomNumber(generator, 9 * 4500) };
+    const auto b { RandomNumber(generator, 9 * 4200) };
+    const auto c { RandomNumber(generator, 9 * 9000) };
+    const auto negative { BigInt{} - b };
+
+    EXPECT_EQ(MultiplyAsync(a, negative).get(), a * negative);
+    EXPECT_EQ(MultiplyAsync(c, b, Inline()).get(), c * b);
+    EXPECT_EQ(MultiplyAsync(BigInt{ 12 }, BigInt{ -5 }).get(), BigInt{ -60 });
+    EXPECT_EQ(OperationContext::Current(), nullptr);
+}
+
+TEST(AsyncTest, AbandonedFutureWaitsForOperation)
+{
+    std::mt19937 generator { 4 };
+    const auto a { RandomNumber(generator, 9 * 5000) };
+    bool isDone { false };
+    AsyncOptions options;
+    options.progress = [&isDone](double fraction) {
+        isDone = fraction == 1.0;
+    };
+    {
+        // the default executor's future owns the thread
+        const auto future { MultiplyAsync(a, a, options) };
+    }
+    EXPECT_TRUE(isDone);
+
+    // a detached thread is opt-in
+    options.executor = DetachedThreadExecutor;
+    EXPECT_EQ(MultiplyAsync(a, BigInt{ 2 }, options).get(), a + a);
+}
+
+TEST(AsyncTest, ProgressIsMonotonic)
+{
+    std::mt19937 generator { 6 };
+    const auto a { RandomNumber(generator, 9 * 9000) };
+    const auto b { RandomNumber(generator, 9 * 8500) };
+    auto options { Inline() };
+    std::vector<double> fractions;
+    options.progress = [&fractions](double fraction) {
+        fractions.push_back(fraction);
+    };
+    EXPECT_EQ(MultiplyAsync(a, b, options).get(), a * b);
+
+    ASSERT_GT(fractions.size(), 3u);
+    EXPECT_TRUE(std::is_sorted(fractions.cbegin(), fractions.cend()));
+    EXPECT_GT(fractions.front(), 0.0);
+    EXPECT_EQ(fractions.back(), 1.0);
+}
+
+TEST(AsyncTest, Cancellation)
+{
+    std::mt19937 generator { 7 };
+    const auto a { RandomNumber(generator, 9 * 9000) };
+    const auto b { RandomNumber(generator, 9 * 9000) };
+
+    auto options { Inline() };
+    options.token.Cancel();
+    EXPECT_THROW(MultiplyAsync(a, b, options).get(), OperationCancelled);
+
+    // cancelled from the first report, stops at the next check
+    options = Inline();
+    size_t reports { 0 };
+    options.progress = [&reports, token = options.token](double) {
+        reports++;
+        token.Cancel();
+    };
+    EXPECT_THROW(MultiplyAsync(a, b, options).get(), OperationCancelled);
+    EXPECT_EQ(reports, 1u);
+    EXPECT_EQ(OperationContext::Current(), nullptr);
+
+    reports = 0;
+    options.token = CancellationToken{};
+    options.progress = [&reports, token = options.token](double) {
+        reports++;
+        token.Cancel();
+    };
+    EXPECT_THROW(ToRadixStringAsync(a, 7, options).get(), OperationCancelled);
+    EXPECT_EQ(reports, 1u);
+
+    // not checked without a context
+    EXPECT_EQ(a * b, b * a);
+}
+
+TEST(AsyncTest, UnbalancedProductsAreChecked)
+{
+    std::mt19937 generator { 9 };
+    // 10^6 x 20 coefficients: the work is above the checkpoint, the shorter operand far below
+    const BigInt a { std::string(9 * 1'000'000, '7') };
+    const auto b { RandomNumber(generator, 9 * 20) };
+    EXPECT_EQ(MultiplyAsync(a, b, Inline()).get(), a * b);
+
+    auto options { Inline() };
+    size_t reports { 0 };
+    options.progress = [&reports, token = options.token](double) {
+        reports++;
+        token.Cancel();
+    };
+    EXPECT_THROW(MultiplyAsync(a, b, options).get(), OperationCancelled);
+    EXPECT_EQ(reports, 1u);
+}
+
+TEST(AsyncTest, LongKnuthDivisionIsChecked)
+{
+    std::mt19937 generator { 10 };
+    // a divisor below NEWTON_DIVISION_THRESHOLD goes by Knuth's division however long the quotient is
+    const BigInt a { std::string(9 * 200'000, '7') };
+    const auto b { RandomNumber(generator, 9 * 1000) };
+
+    auto options { Inline() };
+    size_t reports { 0 };
+    options.progress = [&reports, token = options.token](double) {
+        reports++;
+        token.Cancel();
+    };
+    EXPECT_THROW(DivModAsync(a, b, options).get(), OperationCancelled);
+    EXPECT_EQ(reports, 1u);
+    EXPECT_EQ(OperationContext::Current(), nullptr);
+}
+
+TEST(AsyncTest, OtherOperations)
+{
+    std::mt19937 generator { 8 };
+    const auto a { RandomNumber(generator, 9 * 3000) };
+    const auto b { RandomNumber(generator, 9 * 1100) };
+
+    const auto [div, mod] = DivModAsync(a, b).get();
+    EXPECT_EQ(div, a / b);
+    EXPECT_EQ(mod, a % b);
+    EXPECT_THROW(DivModAsync(a, BigInt{}).get(), std::domain_error);
+
+    const BigInt modulus { "170141183460469231731687303715884105727" };
+    EXPECT_EQ(PowModAsync(a, b, modulus).get(), PowMod(a, b, modulus));
+    EXPECT_EQ(PowModAsync(BigInt{ 3 }, BigInt{ 200 }, BigInt{ 1000 }, Inline()).get(), PowMod(BigInt{ 3 }, BigInt{ 200 }, BigInt{ 1000 }));
+
+    const auto text { ToRadixStringAsync(a, 36).get() };
+    EXPECT_EQ(text, ToRadixString(a, 36));
+    EXPECT_EQ(FromRadixStringAsync(text, 36).get(), a);
+    EXPECT_THROW(FromRadixStringAsync("12", 40).get(), std::domain_error);
+}
@@ -0,0 +1,97 @@
+#include "../BigDecimal.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace {
+    std::string ToString(const BigDecimal& x) {
+        std::ostringstream os;
+        os << x;
+        return os.str();
+    }
+
+    std::string Rounded(const std::string& number, size_t scale, RoundingMode mode) {
+        BigDecimal x { number };
+        x.SetScale(scale, mode);
+        return ToString(x);
+    }
+}
+
+TEST(BigDecimalTest, Parsing)
+{
+    EXPECT_EQ(ToString(BigDecimal{"-12.500"}), "-12.500");
+    EXPECT_EQ(BigDecimal{"-12.500"}.Scale(), 3u);
+    EXPECT_EQ(BigDecimal{"-12.500"}.Unscaled(), BigInt{-12500});
+    EXPECT_EQ(ToString(BigDecimal{"+0.000000000000000001"}), "0.000000000000000001");
+    EXPECT_EQ(ToString(BigDecimal{"-0000000000000.00"}), "0.00");
+    EXPECT_TRUE(BigDecimal{"-0.00"}.IsPositive());
+    EXPECT_EQ(ToString(BigDecimal{"42."}), "42");
+    EXPECT_EQ(ToString(BigDecimal{".5"}), "0.5");
+    EXPECT_EQ(ToString(BigDecimal{BigInt{-5}, 3}), "-0.005");
+    EXPECT_EQ(BigDecimal{"-1234.5678"}.Precision(), 8u);
+    EXPECT_THROW(BigDecimal{""}, std::domain_error);
+    EXPECT_THROW(BigDecimal{"-"}, std::domain_error);
+    EXPECT_THROW(BigDecimal{"1.2.3"}, std::domain_error);
+    EXPECT_THROW(BigDecimal{"12a"}, std::domain_error);
+}
+
+TEST(BigDecimalTest, Arithmetic)
+{
+    const BigDecimal price { "19.99" };
+    const BigDecimal rate { "0.0825" };
+    EXPECT_EQ(ToString(price + rate), "20.0725");
+    EXPECT_EQ(ToString(rate - price), "-19.9075");
+    EXPECT_EQ(ToString(price * rate), "1.649175");
+    EXPECT_EQ(ToString(price * BigDecimal{"-3"}), "-59.97");
+
+    auto x { price };
+    x += x;
+    EXPECT_EQ(ToString(x), "39.98");
+    x -= x;
+    EXPECT_EQ(ToString(x), "0.00");
+
+    EXPECT_EQ(BigDecimal{"1.50"}, BigDecimal{"1.5"});
+    EXPECT_NE(BigDecimal{"1.51"}, BigDecimal{"1.5"});
+    EXPECT_TRUE(BigDecimal{"-2"} < BigDecimal{"1.5"});
+    EXPECT_TRUE(BigDecimal{"-2"} < BigDecimal{"-1.999"});
+    EXPECT_TRUE(BigDecimal{"0.001"} > BigDecimal{"-0.001"});
+    EXPECT_FALSE(BigDecimal{"1.50"} < BigDecimal{"1.5"});
+}
+
+TEST(BigDecimalTest, Rescaling)
+{
+    BigDecimal x { "1.5" };
+    x.SetScale(30);
+    EXPECT_EQ(ToString(x), "1.500000000000000000000000000000");
+    x.SetScale(1);
+    EXPECT_EQ(ToString(x), "1.5");
+    x.SetScale(0, RoundingMode::Down);
+    EXPECT_EQ(ToString(x), "1");
+}
+
+TEST(BigDecimalTest, RoundingModes)
+{
+    // the table of java.math.RoundingMode
+    const std::vector<std::string> values { "5.5", "2.5", "1.6", "1.1", "1.0", "-1.0", "-1.1", "-1.6", "-2.5", "-5.5" };
+    const std::vector<std::pair<RoundingMode, std::vector<std::string>>> expected {
+        { RoundingMode::Up, { "6", "3", "2", "2", "1", "-1", "-2", "-2", "-3", "-6" } },
+        { RoundingMode::Down, { "5", "2", "1", "1", "1", "-1", "-1", "-1", "-2", "-5" } },
+        { RoundingMode::Ceiling, { "6", "3", "2", "2", "1", "-1", "-1", "-1", "-2", "-5" } },
+        { RoundingMode::Floor, { "5", "2", "1", "1", "1", "-1", "-2", "-2", "-3", "-6" } },
+        { RoundingMode::HalfUp, { "6", "3", "2", "1", "1", "-1", "-1", "-2", "-3", "-6" } },
+        { RoundingMode::HalfDown, { "5", "2", "2", "1", "1", "-1", "-1", "-2", "-2", "-5" } },
+        { RoundingMode::HalfEven, { "6", "2", "2", "1", "1", "-1", "-1", "-2", "-2", "-6" } },
+    };
+    for(const auto& [mode, results]: expected) {
+        for(size_t i = 0; i < values.size(); i++) {
+            EXPECT_EQ(Rounded(values[i], 0, mode), results[i]) << values[i];
+        }
+    }
+    // digits below the first dropped one break the ties, across coefficients too
+    EXPECT_EQ(Rounded("2.5000000000000000001", 0, RoundingMode::HalfEven), "3");
+    EXPECT_EQ(Rounded("-2.5000000000000000001", 0, RoundingMode::HalfDown), "-3");
+    EXPECT_EQ(Rounded("2.5000000000000000000", 0, RoundingMode::HalfDown), "2");
+    EXPECT_EQ(Rounded("-0.0000000000000000001", 5, RoundingMode::Floor), "-0.00001");
+    EXPECT_EQ(Rounded("-0.0000000000000000001", 5, RoundingMode::Ceiling), "0.00000");
+    EXPECT_EQ(Rounded("999999999.999999999", 3, RoundingMode::Up), "1000000000.000");
+    EXPECT_EQ(Rounded("123456789123456789.125", 2, RoundingMode::HalfEven), "123456789123456789.12");
+}
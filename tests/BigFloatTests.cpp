@@ -0,0 +1,116 @@
+#include "../BigFloat.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace {
+    std::string ToString(const BigFloat& x) {
+        std::ostringstream os;
+        os << x;
+        return os.str();
+    }
+
+    // number of zeros after the point of |x| < 1
+    size_t FractionZeros(const BigFloat& x) {
+        if( x.IsZero() ) {
+            return std::string::npos;
+        }
+        const auto digits { ToString(x) };
+        const auto point { digits.find('.') };
+        return digits.find_first_not_of('0', point + 1) - point - 1;
+    }
+
+    const std::string PI_200 {
+        "3.14159265358979323846264338327950288419716939937510582097494459230781640628620899862803482534211706798214808651328230664709384460955058223172535940812848111745028410270193852110555964462294895493038196"
+    };
+}
+
+TEST(BigFloatTest, Representation)
+{
+    EXPECT_EQ(ToString(BigFloat{}), "0");
+    EXPECT_EQ(ToString(BigFloat{BigInt{-325}, -1}), "-0.000000325");
+    EXPECT_EQ(ToString(BigFloat{BigInt{12}, 1}), "12000000000");
+
+    // lowest zero coefficients are moved to the exponent
+    const BigFloat x { BigInt{"5000000000000000000"}, -2 };
+    EXPECT_EQ(x.Mantissa(), BigInt{5});
+    EXPECT_EQ(x.Exponent(), 0);
+    EXPECT_EQ(ToString(x), "5");
+
+    // truncated toward zero to the precision
+    const BigFloat y { BigInt{"-123456789987654321111111111"}, 0, 2 };
+    EXPECT_EQ(ToString(y), "-123456789987654321000000000");
+    EXPECT_EQ(BigFloat::PrecisionForDigits(18), 3u);
+    EXPECT_THROW(BigFloat(BigInt{1}, 0, 0), std::domain_error);
+}
+
+TEST(BigFloatTest, Arithmetic)
+{
+    const BigFloat one { BigInt{1}, 0, 2 };
+    const BigFloat three { BigInt{3}, 0, 2 };
+    EXPECT_EQ(ToString(one / three), "0.333333333333333333");
+    EXPECT_EQ(ToString(BigFloat{BigInt{-2}, 0, 2} / three), "-0.666666666666666666");
+    EXPECT_EQ(ToString(three * three - one), "8");
+    EXPECT_EQ(ToString(one - three), "-2");
+    EXPECT_THROW(one / BigFloat{}, std::domain_error);
+
+    // the lower operand is truncated below the precision of the higher one
+    const BigFloat large { BigInt{1}, 10, 2 };
+    const BigFloat small { BigInt{1}, -10, 2 };
+    EXPECT_EQ(large + small, large);
+    EXPECT_EQ(one + small, one);
+    EXPECT_EQ(ToString(BigFloat{BigInt{1}, -10, 20} + one), "1." + std::string(89, '0') + "1");
+
+    auto x { one / three };
+    x -= x;
+    EXPECT_TRUE(x.IsZero());
+    EXPECT_TRUE(x.IsPositive());
+    x = three;
+    x *= x;
+    x += x;
+    EXPECT_EQ(ToString(x), "18");
+}
+
+TEST(BigFloatTest, NewtonIterations)
+{
+    const auto precision { BigFloat::PrecisionForDigits(120) };
+    const BigFloat two { BigInt{2}, 0, precision };
+    EXPECT_EQ(ToString(Sqrt(two)).substr(0, 121), "1.41421356237309504880168872420969807856967187537694807317667973799073247846210703885038753432764157273501384623091229702");
+    EXPECT_EQ(ToString(InverseSqrt(BigFloat{BigInt{4}, 0, precision})), "0.5");
+    // exact roots may be one unit of the last coefficient less
+    EXPECT_GE(FractionZeros(Sqrt(BigFloat{BigInt{144}, -2, precision}) - BigFloat{BigInt{12}, -1}), 9u * precision - 1);
+    EXPECT_TRUE(Sqrt(BigFloat{}).IsZero());
+    EXPECT_THROW(Sqrt(BigFloat{BigInt{-1}}), std::domain_error);
+    EXPECT_THROW(InverseSqrt(BigFloat{}), std::domain_error);
+
+    // large enough for the recursive steps of both iterations
+    const BigFloat x { BigInt{"98765432123456789"} * BigInt{"1234567898765432123456789"}, -5, 400 };
+    const BigFloat one { BigInt{1}, 0, 400 };
+    EXPECT_GE(FractionZeros(one - x * Reciprocal(x)), 9u * 397);
+    const auto root { Sqrt(x) };
+    EXPECT_GE(FractionZeros((root * root - x) / x), 9u * 397);
+}
+
+TEST(BigFloatTest, BinarySplitting)
+{
+    const auto precision { BigFloat::PrecisionForDigits(120) };
+    // e = sum of 1 / k!
+    const auto e { SumSeries(100, [](size_t) { return BigInt{1}; }, [](size_t) { return BigInt{1}; },
+        [](size_t k) { return BigInt{ static_cast<long long>(k? k: 1) }; }, precision) };
+    EXPECT_EQ(ToString(e).substr(0, 121), "2.71828182845904523536028747135266249775724709369995957496696762772407663035354759457138217852516642742746639193200305992");
+
+    // a(k) = k, p(k) = q(k) = 1
+    const auto split { SplitSeries(1, 5, [](size_t k) { return BigInt{ static_cast<long long>(k) }; },
+        [](size_t) { return BigInt{1}; }, [](size_t) { return BigInt{1}; }) };
+    EXPECT_EQ(split.T, BigInt{10});
+    EXPECT_EQ(split.Q, BigInt{1});
+    EXPECT_THROW(SplitSeries(3, 3, nullptr, nullptr, nullptr), std::domain_error);
+}
+
+TEST(BigFloatTest, Pi)
+{
+    EXPECT_EQ(ToString(Pi(BigFloat::PrecisionForDigits(200))).substr(0, PI_200.size()), PI_200);
+    // 2700 digits, the reciprocal and the square root are done by Newton's iterations
+    const auto pi { ToString(Pi(300)) };
+    EXPECT_EQ(pi.substr(0, PI_200.size()), PI_200);
+    EXPECT_EQ(pi.substr(2600, 50), "58900971490967598526136554978189312978482168299894");
+}
@@ -0,0 +1,61 @@
+#include "../BigIntAccumulator.hpp"
+#include <gtest/gtest.h>
+
+TEST(BigIntAccumulatorTest, MatchesSequentialSum)
+{
+    EXPECT_EQ(BigIntAccumulator{}.Value(), BigInt{0});
+    EXPECT_EQ(BigIntAccumulator{ BigInt{-42} }.Value(), BigInt{-42});
+
+    BigIntAccumulator accumulator;
+    BigInt expected { 0 };
+    BigInt value { "999999999999999999999999999" };
+    for(int i = 0; i < 1000; i++) {
+        value = value * BigInt{ 7 } + BigInt{ i };
+        if( i % 3 ) {
+            accumulator += value;
+            expected += value;
+        }
+        else {
+            accumulator -= value;
+            expected -= value;
+        }
+        if( i % 100 == 0 ) {
+            EXPECT_EQ(accumulator.Value(), expected) << "i = " << i;
+        }
+    }
+    EXPECT_EQ(accumulator.Value(), expected);
+    accumulator -= expected;
+    EXPECT_EQ(accumulator.Value(), BigInt{0});
+    EXPECT_TRUE(accumulator.Value().IsPositive());
+}
+
+TEST(BigIntAccumulatorTest, NegativeSumAndBorrows)
+{
+    BigIntAccumulator accumulator;
+    accumulator += BigInt{5};
+    accumulator -= BigInt{"1000000000"};
+    EXPECT_EQ(accumulator.Value(), BigInt{-999999995});
+    accumulator -= BigInt{"999999999999999999999999999"};
+    EXPECT_EQ(accumulator.Value(), BigInt{"-1000000000000000000999999994"});
+    accumulator += BigInt{"1000000000000000000999999994"};
+    EXPECT_EQ(accumulator.Value(), BigInt{0});
+    accumulator.Clear();
+    accumulator -= BigInt{0};
+    EXPECT_EQ(accumulator.Value(), BigInt{0});
+}
+
+TEST(BigIntAccumulatorTest, MergePartialSums)
+{
+    BigIntAccumulator first, second;
+    BigInt expected { 0 };
+    for(int i = 1; i <= 500; i++) {
+        const BigInt value { BigInt{"123456789123456789123456789"} * BigInt{ i % 2? i: -i } };
+        (i % 3? first: second) += value;
+        expected += value;
+    }
+    first.Merge(second);
+    EXPECT_EQ(first.Value(), expected);
+    second.Merge(BigIntAccumulator{});
+    first.Merge(second);
+    EXPECT_EQ(first.Value() - second.Value(), expected);
+}
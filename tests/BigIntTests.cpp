@@ -1,5 +1,6 @@
 #include "BigIntTests.hpp"
 #include <sstream>
+#include <unordered_set>
 
 
 TEST_F(BigIntTest, ConstructWithAllIntegers) 
@@ -87,7 +88,51 @@ TEST_F(BigIntTest, IsLesserComparable)
     }
 } 
 
-// TDOO: add other comparison operator tests!
+TEST_F(BigIntTest, ThreeWayComparison)
+{
+    // ascending
+    const std::array<BigInt, 7> values {
+        BigInt{"-1000000000000000000000"}, BigInt{"-999999999999999999999"}, BigInt{-1},
+        BigInt{0}, BigInt{1}, BigInt{"999999999"}, BigInt{"1000000000"}
+    };
+    for(size_t i = 0; i < values.size(); i++) {
+        for(size_t j = 0; j < values.size(); j++) {
+            const auto& lhs { values[i] };
+            const auto& rhs { values[j] };
+            EXPECT_EQ(Compare(lhs, rhs) < 0, i < j) << lhs << " <=> " << rhs;
+            EXPECT_EQ(Compare(lhs, rhs) == 0, i == j) << lhs << " <=> " << rhs;
+            EXPECT_EQ(lhs < rhs, i < j);
+            EXPECT_EQ(lhs > rhs, i > j);
+            EXPECT_EQ(lhs <= rhs, i <= j);
+            EXPECT_EQ(lhs >= rhs, i >= j);
+            EXPECT_EQ(lhs == rhs, i == j);
+            EXPECT_EQ(lhs != rhs, i != j);
+        }
+    }
+}
+
+TEST_F(BigIntTest, HashIsConsistentWithEquality)
+{
+    const std::hash<BigInt> hash;
+    EXPECT_EQ(hash(BigInt{"123456789123456789123456789"}), hash(BigInt{"123456789123456789123456789"}));
+    EXPECT_EQ(hash(BigInt{0}), hash(BigInt{-5} + BigInt{5}));
+    EXPECT_NE(hash(BigInt{5}), hash(BigInt{-5}));
+
+    std::unordered_set<BigInt> set;
+    auto power { BigInt{1} };
+    for(int i = 0; i < 2000; i++) {
+        set.insert(power);
+        set.insert(BigInt{0} - power - BigInt{i});
+        power *= BigInt{3};
+    }
+    for(int i = 0; i < 2000; i++) {
+        set.insert(BigInt{i});
+    }
+    // 3^0..3^6 are below 2000
+    EXPECT_EQ(set.size(), 6000u - 7u);
+    EXPECT_EQ(set.count(BigInt{1999}), 1u);
+    EXPECT_EQ(set.count(BigInt{2000}), 0u);
+}
 
 TEST_F(BigIntTest, SubstractSmallerPositiveInteger) 
 {
@@ -211,6 +256,59 @@ TEST_F(BigIntTest, MultiplyWithBigIntOperand)
     }
 }
 
+TEST(FusedMultiplicationTest, MatchesOperators)
+{
+    const std::vector<BigInt> values {
+        BigInt{0}, BigInt{1}, BigInt{-1}, BigInt{999999999}, BigInt{"-1000000000"},
+        BigInt{"123456789123456789123456789123456789"}, BigInt{"-999999999999999999999999999999999999999"},
+        BigInt{"123456789"} * BigInt{"987654321987654321987654321"} * BigInt{"-1000000007"}
+    };
+    auto huge { values.back() };
+    for(int i = 0; i < 5; i++) {
+        huge = huge * huge + BigInt{ i };
+    }
+    auto cases { values };
+    cases.push_back(huge);
+    cases.push_back(BigInt{0} - huge);
+
+    BigInt out { "5" };
+    for(const auto& lhs: cases) {
+        for(const auto& rhs: cases) {
+            Multiply(out, lhs, rhs);
+            EXPECT_EQ(out, lhs * rhs);
+            for(const auto& value: cases) {
+                auto accumulator { value };
+                AddMultiply(accumulator, lhs, rhs);
+                EXPECT_EQ(accumulator, value + lhs * rhs);
+                EXPECT_TRUE(!accumulator.IsZero() || accumulator.IsPositive());
+                accumulator = value;
+                SubstractMultiply(accumulator, lhs, rhs);
+                EXPECT_EQ(accumulator, value - lhs * rhs);
+                EXPECT_TRUE(!accumulator.IsZero() || accumulator.IsPositive());
+            }
+        }
+    }
+}
+
+TEST(FusedMultiplicationTest, OutputMayBeOperand)
+{
+    for(auto value: { BigInt{"-123456789123456789123456789"}, BigInt{"123456789123456789"} * BigInt{"1000000000000000000000"} }) {
+        const auto square { value * value };
+        auto x { value };
+        Multiply(x, x, x);
+        EXPECT_EQ(x, square);
+        x = value;
+        Multiply(x, x, BigInt{-3});
+        EXPECT_EQ(x, value * BigInt{-3});
+        x = value;
+        AddMultiply(x, x, x);
+        EXPECT_EQ(x, value + square);
+        x = value;
+        SubstractMultiply(x, BigInt{2}, x);
+        EXPECT_EQ(x, BigInt{0} - value);
+    }
+}
+
 TEST_F(BigIntTest, LeftShift) {
     BigInt lhs { "1293123" };
     helper::Tests test(&lhs);
@@ -289,6 +387,103 @@ TEST_F(BigIntTest, ModWithBigIntOperand)
     }
 }
 
-/// Zero division exception
+TEST(SimpleDivisionTest, CustomMadeTestsPass)
+{
+    const BigInt lhs { 
+        "619603168660070813205298366751281542689789636930238089584600900997309299356859233709833451685176"
+        "543061689027083846229274775685567669789635536162927781266140123440375025088320757606873177679222"
+        "810999400140902493"
+    };
+    const BigInt rhs {
+        "1301281659663332328429103377569337250451757741376491424758487347069536507149301907940927064"
+    };
+    const BigInt div {
+        "476148391133380442302093244664585663234086709251592396216349704443916233264462898871205415180854"
+        "832076412075286433640355"
+    };
+    const BigInt mod {
+        "892794759800538321210029557845119656938551774790101262106040136633187850446378165078834773"
+    };
+    EXPECT_EQ(lhs / rhs, div);
+    EXPECT_EQ(lhs % rhs, mod);
+    EXPECT_EQ((lhs / rhs) * rhs + lhs % rhs, lhs);
+    // truncated division: quotient rounds toward zero, reminder has the sign of dividend
+    EXPECT_EQ((BigInt{0} - lhs) / rhs, BigInt{0} - div);
+    EXPECT_EQ((BigInt{0} - lhs) % rhs, BigInt{0} - mod);
+    EXPECT_EQ(lhs / (BigInt{0} - rhs), BigInt{0} - div);
+    EXPECT_EQ(lhs % (BigInt{0} - rhs), mod);
+
+    EXPECT_EQ(BigInt{"1000000000000000000"} / BigInt{"999999999"}, BigInt{"1000000001"});
+    EXPECT_EQ(BigInt{"1000000000000000000"} % BigInt{"999999999"}, BigInt{"1"});
+    EXPECT_EQ(BigInt{-7} / BigInt{2}, BigInt{-3});
+    EXPECT_EQ(BigInt{-7} % BigInt{2}, BigInt{-1});
+    EXPECT_EQ(rhs / lhs, BigInt{0});
+    EXPECT_EQ(rhs % lhs, rhs);
+}
+
+TEST(SimpleDivisionTest, NewtonDivisionMatchesKnuth)
+{
+    // divisor is long enough for Newton's iteration of the reciprocal
+    BigInt lhs { 3 }, rhs { 7 };
+    for(int i = 0; i < 14; i++) {
+        lhs = KaratsubaMultiplication(lhs, lhs);
+        if( i < 12 ) rhs = KaratsubaMultiplication(rhs, rhs);
+    }
+    rhs += BigInt{ 1 };
+    for(auto dividend: { lhs - BigInt{ 1 }, lhs, KaratsubaMultiplication(lhs, rhs), rhs * BigInt{ 5 } }) {
+        helper::Tests test(&dividend);
+        const auto expected { test.DivModKnuth(rhs) };
+        const auto actual { test.DivModNewton(rhs) };
+        EXPECT_EQ(actual.first, expected.first);
+        EXPECT_EQ(actual.second, expected.second);
+    }
+}
+
+TEST(SimpleDivisionTest, ZeroDivisionThrows)
+{
+    EXPECT_THROW(BigInt{1} / BigInt{0}, std::domain_error);
+    EXPECT_THROW(BigInt{1} % BigInt{"0"}, std::domain_error);
+}
+
+/// Decimal digits
+TEST(DecimalDigitsTest, PowersOfTen)
+{
+    BigInt x { "-123456789123" };
+    x.ScaleByPow10(13);
+    EXPECT_EQ(x, BigInt{"-1234567891230000000000000"});
+    x.TruncDivPow10(15);
+    EXPECT_EQ(x, BigInt{"-1234567891"});
+    x.TruncDivPow10(9);
+    EXPECT_EQ(x, BigInt{-1});
+    x.TruncDivPow10(1);
+    EXPECT_TRUE(x.IsZero());
+    EXPECT_TRUE(x.IsPositive());
+    x.ScaleByPow10(100);
+    EXPECT_TRUE(x.IsZero());
+
+    BigInt y { "999999999" };
+    y.ScaleByPow10(9);
+    EXPECT_EQ(y, BigInt{"999999999000000000"});
+    y.ScaleByPow10(4);
+    EXPECT_EQ(y, BigInt{"9999999990000000000000"});
+    y.TruncDivPow10(100);
+    EXPECT_EQ(y, BigInt{0});
+}
+
+TEST(DecimalDigitsTest, DigitExtraction)
+{
+    const BigInt x { "-1020304050607080900" };
+    EXPECT_EQ(x.DigitCount(), 19u);
+    EXPECT_EQ(BigInt{0}.DigitCount(), 1u);
+    EXPECT_EQ(BigInt{999999999}.DigitCount(), 9u);
+    EXPECT_EQ(BigInt{1000000000}.DigitCount(), 10u);
+    EXPECT_EQ(x.Digit(0), 0);
+    EXPECT_EQ(x.Digit(2), 9);
+    EXPECT_EQ(x.Digit(8), 6);
+    EXPECT_EQ(x.Digit(10), 5);
+    EXPECT_EQ(x.Digit(18), 1);
+    EXPECT_EQ(x.Digit(19), 0);
+    EXPECT_EQ(x.Digit(1000), 0);
+}
 
-/// Negative arguments
\ No newline at end of file
+/// Negative arguments
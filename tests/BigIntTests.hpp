@@ -46,6 +46,14 @@ namespace helper {
             return m_bigInt->CutOffRank(rank);
         }
 
+        std::pair<BigInt, BigInt> DivModKnuth(const BigInt& rhs) {
+            return m_bigInt->DivModKnuth(rhs);
+        }
+
+        std::pair<BigInt, BigInt> DivModNewton(const BigInt& rhs) {
+            return m_bigInt->DivModNewton(rhs);
+        }
+
     private:
         // tested value
         BigInt* m_bigInt;
@@ -0,0 +1,118 @@
+#include "../BigRational.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace {
+    std::string ToString(const BigRational& x) {
+        std::ostringstream os;
+        os << x;
+        return os.str();
+    }
+}
+
+TEST(BigRationalTest, Construction)
+{
+    EXPECT_EQ(ToString(BigRational{}), "0");
+    EXPECT_EQ(ToString(BigRational{BigInt{6}, BigInt{-4}}), "-3/2");
+    EXPECT_EQ(ToString(BigRational{BigInt{-6}, BigInt{-3}}), "2");
+    EXPECT_EQ(ToString(BigRational{BigInt{0}, BigInt{-3}}), "0");
+    EXPECT_TRUE(BigRational(BigInt{0}, BigInt{-3}).Numerator().IsPositive());
+    EXPECT_THROW(BigRational(BigInt{1}, BigInt{0}), std::domain_error);
+
+    // common powers of ten are removed right away
+    const BigRational x { BigInt{"3000000000000000000"}, BigInt{"7000000000000000000000"} };
+    EXPECT_EQ(x.Numerator(), BigInt{3});
+    EXPECT_EQ(x.Denominator(), BigInt{7000});
+}
+
+TEST(BigRationalTest, HarmonicNumbers)
+{
+    BigRational sum;
+    for(int i = 1; i <= 10; i++) {
+        sum += BigRational{BigInt{1}, BigInt{i}};
+    }
+    EXPECT_EQ(ToString(sum), "7381/2520");
+
+    for(int i = 11; i <= 300; i++) {
+        sum += BigRational{BigInt{1}, BigInt{i}};
+    }
+    // lazy reduction keeps the denominator within a constant factor of the reduced one
+    auto reduced { sum };
+    reduced.Reduce();
+    EXPECT_EQ(sum, reduced);
+    EXPECT_LE(ToString(sum.Denominator()).size(), 2 * ToString(reduced.Denominator()).size() + 9 * 8);
+
+    for(int i = 300; i >= 1; i--) {
+        sum -= BigRational{BigInt{1}, BigInt{i}};
+    }
+    EXPECT_EQ(sum, BigRational{});
+    EXPECT_EQ(ToString(sum), "0");
+}
+
+TEST(BigRationalTest, Arithmetic)
+{
+    const BigRational a { BigInt{2}, BigInt{3} };
+    const BigRational b { BigInt{-5}, BigInt{7} };
+    EXPECT_EQ(ToString(a + b), "-1/21");
+    EXPECT_EQ(ToString(a - b), "29/21");
+    EXPECT_EQ(ToString(a * b), "-10/21");
+    EXPECT_EQ(ToString(a / b), "-14/15");
+    EXPECT_EQ(ToString(b / a), "-15/14");
+    EXPECT_EQ(ToString(a * BigRational{BigInt{3}}), "2");
+    EXPECT_EQ(ToString(a / a), "1");
+    EXPECT_EQ(ToString(a - a), "0");
+    EXPECT_THROW(a / BigRational{}, std::domain_error);
+
+    // integer operands
+    EXPECT_EQ(ToString(a + BigRational{BigInt{-1}}), "-1/3");
+    EXPECT_EQ(ToString(BigRational{BigInt{-1}} - a), "-5/3");
+    EXPECT_EQ(ToString(BigRational{BigInt{4}} + BigRational{BigInt{-4}}), "0");
+    EXPECT_EQ(ToString(BigRational{BigInt{2}} - a), "4/3");
+}
+
+TEST(BigRationalTest, OperandMayBeThis)
+{
+    BigRational x { BigInt{3}, BigInt{4} };
+    x += x;
+    EXPECT_EQ(ToString(x), "3/2");
+    x *= x;
+    EXPECT_EQ(ToString(x), "9/4");
+    x /= x;
+    EXPECT_EQ(ToString(x), "1");
+    x += x;
+    EXPECT_EQ(ToString(x), "2");
+    x -= x;
+    EXPECT_EQ(ToString(x), "0");
+    EXPECT_TRUE(x.Numerator().IsPositive());
+}
+
+TEST(BigRationalTest, Comparison)
+{
+    const BigRational a { BigInt{-1}, BigInt{2} };
+    const BigRational b { BigInt{1}, BigInt{3} };
+    const BigRational c { BigInt{-2}, BigInt{3} };
+    EXPECT_TRUE(a < b);
+    EXPECT_TRUE(c < a);
+    EXPECT_TRUE(c < b);
+    EXPECT_TRUE(b > c);
+    EXPECT_FALSE(a < a);
+    EXPECT_FALSE(b < a);
+    EXPECT_TRUE(a != b);
+    EXPECT_EQ(a, (BigRational{BigInt{3}, BigInt{-6}}));
+    EXPECT_TRUE(BigRational{} < b);
+    EXPECT_TRUE(a < BigRational{});
+}
+
+TEST(BigRationalTest, ReduceGivesLowestTerms)
+{
+    BigRational x { BigInt{"123456789123456789"}, BigInt{"987654321987654321"} };
+    x *= BigRational{BigInt{"987654321987654321"}, BigInt{"123456789123456789"}};
+    x.Reduce();
+    EXPECT_EQ(x.Numerator(), BigInt{1});
+    EXPECT_EQ(x.Denominator(), BigInt{1});
+
+    BigRational y { BigInt{"1000000007"} * BigInt{"998244353"}, BigInt{"1000000007"} * BigInt{"-1000000009"} };
+    y.Reduce();
+    EXPECT_EQ(y.Numerator(), BigInt{"-998244353"});
+    EXPECT_EQ(y.Denominator(), BigInt{"1000000009"});
+}
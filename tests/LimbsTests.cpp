@@ -0,0 +1,84 @@
+#include "../Limbs.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using limbs::Limb;
+using limbs::RADIX;
+
+namespace {
+    std::vector<Limb> RandomLimbs(std::mt19937& generator, size_t size) {
+        std::vector<Limb> result (size);
+        for(auto& limb: result) {
+            limb = static_cast<Limb>(generator() % RADIX);
+        }
+        return result;
+    }
+}
+
+TEST(LimbsTest, AddAndSubstractPropagateCarries)
+{
+    const std::vector<Limb> lhs { RADIX - 1, RADIX - 1, RADIX - 1, 5 };
+    const std::vector<Limb> one { 1 };
+    std::vector<Limb> sum (lhs.size());
+    EXPECT_EQ(limbs::Add(sum.data(), lhs.data(), lhs.size(), one.data(), one.size()), 0);
+    EXPECT_EQ(sum, (std::vector<Limb>{ 0, 0, 0, 6 }));
+
+    std::vector<Limb> difference (lhs.size());
+    EXPECT_EQ(limbs::Substract(difference.data(), sum.data(), sum.size(), one.data(), one.size()), 0);
+    EXPECT_EQ(difference, lhs);
+
+    // in place, carry and borrow out of the highest limb
+    std::vector<Limb> value { RADIX - 1, RADIX - 1 };
+    EXPECT_EQ(limbs::Add(value.data(), value.data(), value.size(), one.data(), one.size()), 1);
+    EXPECT_EQ(value, (std::vector<Limb>{ 0, 0 }));
+    EXPECT_EQ(limbs::Substract(value.data(), value.data(), value.size(), one.data(), one.size()), 1);
+    EXPECT_EQ(value, (std::vector<Limb>{ RADIX - 1, RADIX - 1 }));
+}
+
+TEST(LimbsTest, SmallFactorKernels)
+{
+    const std::vector<Limb> lhs { RADIX - 1, 123456789, RADIX - 1 };
+    std::vector<Limb> product (lhs.size());
+    const auto high { limbs::MultiplyBySmall(product.data(), lhs.data(), lhs.size(), RADIX - 1) };
+    // AddMultiply then SubstractMultiply of the same product restores the value
+    std::vector<Limb> value { 7, 8, 9 };
+    const auto carry { limbs::AddMultiplyBySmall(value.data(), lhs.data(), lhs.size(), RADIX - 1) };
+    EXPECT_GE(carry, high);
+    const auto borrow { limbs::SubstractMultiplyBySmall(value.data(), lhs.data(), lhs.size(), RADIX - 1) };
+    EXPECT_EQ(borrow, carry);
+    EXPECT_EQ(value, (std::vector<Limb>{ 7, 8, 9 }));
+
+    std::vector<Limb> quotient (product.size() + 1);
+    std::vector<Limb> full { product };
+    full.push_back(high);
+    EXPECT_EQ(limbs::DivideBySmall(quotient.data(), full.data(), full.size(), RADIX - 1), 0u);
+    EXPECT_EQ(limbs::Normalize(quotient.data(), quotient.size()), lhs.size());
+    EXPECT_EQ(limbs::Compare(quotient.data(), lhs.data(), lhs.size()), 0);
+    EXPECT_EQ(limbs::RemainderBySmall(lhs.data(), lhs.size(), 4'000'000'000u), limbs::DivideBySmall(quotient.data(), lhs.data(), lhs.size(), 4'000'000'000u));
+    EXPECT_EQ(limbs::Compare(lhs.data(), value.data(), value.size()), 1);
+    EXPECT_EQ(limbs::Compare(value.data(), lhs.data(), value.size()), -1);
+}
+
+TEST(LimbsTest, KaratsubaMatchesBasecase)
+{
+    std::mt19937 generator { 42 };
+    for(size_t lhsSize: { 1u, 24u, 25u, 64u, 97u, 300u, 1000u }) {
+        for(size_t rhsSize: { 1u, 24u, 25u, 64u, 97u, 300u }) {
+            if( rhsSize > lhsSize ) continue;
+            const auto lhs { RandomLimbs(generator, lhsSize) };
+            const auto rhs { RandomLimbs(generator, rhsSize) };
+            std::vector<Limb> expected (lhsSize + rhsSize), actual (lhsSize + rhsSize);
+            std::vector<Limb> scratch (limbs::MultiplyScratchSize(lhsSize, rhsSize));
+            limbs::MultiplyBasecase(expected.data(), lhs.data(), lhsSize, rhs.data(), rhsSize);
+            limbs::Multiply(actual.data(), lhs.data(), lhsSize, rhs.data(), rhsSize, scratch.data());
+            EXPECT_EQ(actual, expected) << lhsSize << " x " << rhsSize;
+        }
+    }
+    // the largest limbs maximize carries
+    const std::vector<Limb> nines (200, RADIX - 1);
+    std::vector<Limb> expected (400), actual (400), scratch (limbs::KaratsubaScratchSize(200));
+    limbs::MultiplyBasecase(expected.data(), nines.data(), nines.size(), nines.data(), nines.size());
+    limbs::MultiplyKaratsuba(actual.data(), nines.data(), nines.data(), nines.size(), scratch.data());
+    EXPECT_EQ(actual, expected);
+}
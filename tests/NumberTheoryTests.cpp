@@ -0,0 +1,148 @@
+#include "../NumberTheory.hpp"
+#include <gtest/gtest.h>
+
+namespace {
+    // Fibonacci numbers are the worst case for Euclid's algorithm
+    BigInt Fibonacci(size_t n) {
+        BigInt prev { 0 }, cur { 1 };
+        for(size_t i = 0; i < n; i++) {
+            auto next { prev + cur };
+            prev = std::move(cur);
+            cur = std::move(next);
+        }
+        return prev;
+    }
+}
+
+TEST(GcdTest, SmallIntegers)
+{
+    EXPECT_EQ(Gcd(BigInt{0}, BigInt{0}), BigInt{0});
+    EXPECT_EQ(Gcd(BigInt{0}, BigInt{-15}), BigInt{15});
+    EXPECT_EQ(Gcd(BigInt{12}, BigInt{18}), BigInt{6});
+    EXPECT_EQ(Gcd(BigInt{-12}, BigInt{18}), BigInt{6});
+    EXPECT_EQ(Gcd(BigInt{"1000000000000000000"}, BigInt{"999999999"}), BigInt{1});
+}
+
+TEST(GcdTest, MediumIntegers)
+{
+    const BigInt lhs { 
+        "8632455004893216467524805843329910522540032365878616295254990774210974057738830113926280789541336"
+        "505921492487133629173393829721620223115802839816160"
+    };
+    const BigInt rhs {
+        "8701445100500275094784317263957237267912596695640070652928792038579841280123248951292880575323829"
+        "5871306354145519015625287066671842224"
+    };
+    const BigInt gcd { "226581860102902797082248015710449407844888809150263543556208" };
+    EXPECT_EQ(Gcd(lhs, rhs), gcd);
+    EXPECT_EQ(Gcd(rhs, lhs), gcd);
+}
+
+TEST(GcdTest, LargeFibonacciIntegers)
+{
+    // gcd(F(m), F(n)) = F(gcd(m, n))
+    EXPECT_EQ(Gcd(Fibonacci(6000), Fibonacci(9000)), Fibonacci(3000));
+    EXPECT_EQ(Gcd(Fibonacci(9001), Fibonacci(9000)), BigInt{1});
+}
+
+TEST(ExtendedGcdTest, CofactorsSatisfyBezoutIdentity)
+{
+    const std::pair<BigInt, BigInt> args[] = {
+        { BigInt{0}, BigInt{0} },
+        { BigInt{0}, BigInt{7} },
+        { BigInt{240}, BigInt{-46} },
+        { BigInt{-240}, BigInt{-46} },
+        { Fibonacci(1000), Fibonacci(1001) },
+        { Fibonacci(9001) * Fibonacci(50), Fibonacci(6000) }
+    };
+    for(const auto& [lhs, rhs]: args) {
+        auto [g, s, t] = ExtendedGcd(lhs, rhs);
+        EXPECT_EQ(g, Gcd(lhs, rhs));
+        EXPECT_EQ(lhs * s + rhs * t, g) << lhs << ", " << rhs;
+    }
+}
+
+TEST(ModularInverseTest, InvertibleAndNotInvertible)
+{
+    const BigInt modulus { "10000000000000000000000000000000000000123" };
+    EXPECT_EQ(ModularInverse(BigInt{"164561058206435167621910719889530294"}, modulus), 
+        BigInt{"624909613174220562596376512566158858529"});
+    EXPECT_EQ(ModularInverse(BigInt{-1}, BigInt{7}), BigInt{6});
+    EXPECT_EQ(ModularInverse(BigInt{5}, BigInt{1}), BigInt{0});
+
+    const auto fib { Fibonacci(3001) };
+    const auto inverse { ModularInverse(Fibonacci(3000), fib) };
+    EXPECT_EQ(Fibonacci(3000) * inverse % fib, BigInt{1});
+
+    EXPECT_THROW(ModularInverse(BigInt{6}, BigInt{9}), std::domain_error);
+    EXPECT_THROW(ModularInverse(BigInt{6}, BigInt{0}), std::domain_error);
+    EXPECT_THROW(ModularInverse(BigInt{6}, BigInt{-7}), std::domain_error);
+}
+
+TEST(IntegerRootTest, SmallIntegers)
+{
+    EXPECT_EQ(IntegerSqrt(BigInt{0}), BigInt{0});
+    EXPECT_EQ(IntegerSqrt(BigInt{1}), BigInt{1});
+    EXPECT_EQ(IntegerSqrt(BigInt{15}), BigInt{3});
+    EXPECT_EQ(IntegerSqrt(BigInt{16}), BigInt{4});
+    EXPECT_EQ(IntegerSqrt(BigInt{"999999999999999999"}), BigInt{999999999});
+    EXPECT_EQ(IntegerRoot(BigInt{26}, 3), BigInt{2});
+    EXPECT_EQ(IntegerRoot(BigInt{27}, 3), BigInt{3});
+    EXPECT_EQ(IntegerRoot(BigInt{-27}, 3), BigInt{-3});
+    EXPECT_EQ(IntegerRoot(BigInt{100}, 1), BigInt{100});
+    EXPECT_EQ(IntegerRoot(BigInt{"1000000000000000000000"}, 100), BigInt{1});
+
+    EXPECT_THROW(IntegerSqrt(BigInt{-1}), std::domain_error);
+    EXPECT_THROW(IntegerRoot(BigInt{-16}, 4), std::domain_error);
+    EXPECT_THROW(IntegerRoot(BigInt{16}, 0), std::domain_error);
+}
+
+TEST(IntegerRootTest, LargeIntegers)
+{
+    // 3^700 + 12345
+    const BigInt value {
+        "9657802140591758043812442031522928437371194636776843099838260055342219733688083412928987321682"
+        "8803323969272872428056445489018342349722805640728807351275682424603943362477614819993429912102"
+        "2056130447952344195612881280885939338877648480881191091554123269303553459022671145804324207421"
+        "1993816993921587180335757972232760635320184916666346"
+    };
+    EXPECT_EQ(IntegerSqrt(value), BigInt{
+        "9827411734832197435304478092802269750354379410899622414990269025543816811810792722493905789535"
+        "6483251830948245334782867413814443266637838233302304694183773324275704249"
+    });
+    EXPECT_EQ(IntegerRoot(value, 5), BigInt{"6265787482177970379256224194341930332206694446810665274859598050801"});
+    EXPECT_EQ(IntegerRoot(value, 13), BigInt{"49107122286933548933295267"});
+
+    const auto fib { Fibonacci(5000) };
+    EXPECT_EQ(IntegerSqrt(fib * fib), fib);
+    EXPECT_EQ(IntegerSqrt(fib * fib - BigInt{1}), fib - BigInt{1});
+    EXPECT_EQ(IntegerRoot(fib * fib * fib, 3), fib);
+    EXPECT_EQ(IntegerRoot(fib * fib * fib - BigInt{1}, 3), fib - BigInt{1});
+}
+
+TEST(PerfectPowerTest, SquaresAndPowers)
+{
+    EXPECT_TRUE(IsPerfectSquare(BigInt{0}));
+    EXPECT_TRUE(IsPerfectSquare(BigInt{1}));
+    EXPECT_TRUE(IsPerfectSquare(BigInt{"1000000000000000000"}));
+    EXPECT_FALSE(IsPerfectSquare(BigInt{2}));
+    EXPECT_FALSE(IsPerfectSquare(BigInt{-4}));
+
+    const auto fib { Fibonacci(3000) };
+    EXPECT_TRUE(IsPerfectSquare(fib * fib));
+    EXPECT_FALSE(IsPerfectSquare(fib * fib + BigInt{1}));
+    EXPECT_FALSE(IsPerfectSquare(fib * fib - BigInt{1}));
+    EXPECT_FALSE(IsPerfectSquare(fib * fib * BigInt{10}));
+
+    EXPECT_TRUE(IsPerfectPower(BigInt{1}));
+    EXPECT_TRUE(IsPerfectPower(BigInt{-8}));
+    EXPECT_TRUE(IsPerfectPower(BigInt{"1000000000000000000000"}));
+    EXPECT_FALSE(IsPerfectPower(BigInt{-4}));
+    EXPECT_FALSE(IsPerfectPower(BigInt{12}));
+
+    const auto small { Fibonacci(100) };
+    const auto seventh { small * small * small * small * small * small * small };
+    EXPECT_TRUE(IsPerfectPower(seventh));
+    EXPECT_TRUE(IsPerfectPower(BigInt{0} - seventh));
+    EXPECT_FALSE(IsPerfectPower(seventh + BigInt{1}));
+}
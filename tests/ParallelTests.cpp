@@ -0,0 +1,48 @@
+#include "../Parallel.hpp"
+#include "TestUtilities.hpp"
+#include <gtest/gtest.h>
+
+namespace {
+    // enough coefficients for 4 blocks
+    constexpr size_t DIGITS { 9 * 4 * 65536 + 5 };
+}
+
+TEST(ParallelTest, CarriesRippleAcrossBlocks)
+{
+    const BigInt nines { std::string(DIGITS, '9') };
+    const BigInt one { 1 };
+    auto power { one };
+    power.ScaleByPow10(DIGITS);
+
+    EXPECT_EQ(ParallelAdd(nines, one, 4), power);
+    EXPECT_EQ(ParallelAdd(one, nines, 4), power);
+    EXPECT_EQ(ParallelSubstract(power, one, 4), nines);
+    EXPECT_EQ(ParallelSubstract(one, power, 4), one - power);
+    EXPECT_EQ(ParallelAdd(nines, nines, 4), nines + nines);
+}
+
+TEST(ParallelTest, MatchesSequentialOperators)
+{
+    std::mt19937 generator { 42 };
+    const auto lhs { RandomNumber(generator, DIGITS) };
+    const auto rhs { RandomNumber(generator, DIGITS - 1000) };
+    const auto small { RandomNumber(generator, 50) };
+    for(unsigned threadCount: { 1u, 3u, 4u }) {
+        for(const auto& [a, b]: { std::pair{ lhs, rhs }, std::pair{ rhs, lhs }, std::pair{ lhs, small }, std::pair{ small, lhs } }) {
+            auto negativeA { a }, negativeB { b };
+            -negativeA, -negativeB;
+            EXPECT_EQ(ParallelAdd(a, b, threadCount), a + b);
+            EXPECT_EQ(ParallelAdd(a, negativeB, threadCount), a + negativeB);
+            EXPECT_EQ(ParallelAdd(negativeA, b, threadCount), negativeA + b);
+            EXPECT_EQ(ParallelAdd(negativeA, negativeB, threadCount), negativeA + negativeB);
+            EXPECT_EQ(ParallelSubstract(a, b, threadCount), a - b);
+            EXPECT_EQ(ParallelSubstract(negativeA, b, threadCount), negativeA - b);
+            EXPECT_EQ(ParallelSubstract(a, negativeB, threadCount), a - negativeB);
+        }
+    }
+    const auto zero { ParallelSubstract(lhs, lhs, 4) };
+    EXPECT_TRUE(zero.IsZero());
+    EXPECT_TRUE(zero.IsPositive());
+    EXPECT_EQ(ParallelAdd(BigInt{0}, BigInt{-5}), BigInt{-5});
+    EXPECT_EQ(ParallelSubstract(BigInt{0}, BigInt{0}), BigInt{0});
+}
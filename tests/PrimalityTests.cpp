@@ -0,0 +1,116 @@
+#include "../Primality.hpp"
+#include <gtest/gtest.h>
+
+namespace {
+    BigInt PowerOfTwo(size_t exponent) {
+        BigInt result { 1 };
+        for(size_t i = 0; i < exponent; i++) {
+            result += result;
+        }
+        return result;
+    }
+}
+
+TEST(PowModTest, MontgomeryAndPlainModuli)
+{
+    const BigInt base { "1328221009966658550846953834599263485347303735486886792856524326951478097480333706218863685" };
+    const BigInt exponent { "1517652289088605055357534098682020622187456567224546820455840" };
+    // coprime to RADIX: Montgomery form
+    EXPECT_EQ(PowMod(base, exponent, BigInt{"54314484353974878918833823043703112788444063164769804218895646712080277563959"}),
+        BigInt{"5866108792073472343632716894089665184118345351638601438250711301529976037813"});
+    // divisible by 10
+    EXPECT_EQ(PowMod(base, exponent, BigInt{"15185194610682960497489135529421247567712355648289275803858215355821338421760"}),
+        BigInt{"8900538701051038978762064539704288404049151955446692490716359860946569364865"});
+
+    EXPECT_EQ(PowMod(BigInt{-2}, BigInt{3}, BigInt{7}), BigInt{6});
+    EXPECT_EQ(PowMod(BigInt{5}, BigInt{0}, BigInt{7}), BigInt{1});
+    EXPECT_EQ(PowMod(BigInt{5}, BigInt{0}, BigInt{1}), BigInt{0});
+    EXPECT_THROW(PowMod(BigInt{5}, BigInt{-1}, BigInt{7}), std::domain_error);
+    EXPECT_THROW(PowMod(BigInt{5}, BigInt{1}, BigInt{0}), std::domain_error);
+}
+
+TEST(PrimalityTest, SmallIntegers)
+{
+    std::vector<int> primes;
+    for(int i = -5; i < 3000; i++) {
+        bool isPrime { i > 1 };
+        for(int d = 2; d * d <= i && isPrime; d++) {
+            isPrime = i % d;
+        }
+        EXPECT_EQ(IsProbablePrime(BigInt{i}), isPrime) << i;
+        EXPECT_EQ(IsPrime(BigInt{i}), isPrime) << i;
+    }
+}
+
+TEST(PrimalityTest, PseudoprimesAreRejected)
+{
+    // strong pseudoprimes to base 2
+    EXPECT_TRUE(IsStrongProbablePrime(BigInt{2047}, BigInt{2}));
+    EXPECT_TRUE(IsStrongProbablePrime(BigInt{3215031751}, BigInt{2}));
+    EXPECT_FALSE(IsProbablePrime(BigInt{2047}));
+    EXPECT_FALSE(IsProbablePrime(BigInt{3215031751}));
+    EXPECT_FALSE(IsPrime(BigInt{3215031751}));
+    // Carmichael numbers
+    EXPECT_FALSE(IsProbablePrime(BigInt{41041}));
+    EXPECT_FALSE(IsProbablePrime(BigInt{"9999109081"}));
+    // strong pseudoprime to bases 2..23 without small factors: rejected by Lucas test
+    EXPECT_TRUE(IsStrongProbablePrime(BigInt{"3825123056546413051"}, BigInt{2}));
+    EXPECT_FALSE(IsProbablePrime(BigInt{"3825123056546413051"}));
+    EXPECT_FALSE(IsPrime(BigInt{"3825123056546413051"}));
+    // strong pseudoprime to the first 12 prime bases
+    EXPECT_FALSE(IsPrime(BigInt{"318665857834031151167461"}));
+    EXPECT_FALSE(IsProbablePrime(BigInt{"318665857834031151167461"}));
+    // square of a prime
+    EXPECT_FALSE(IsProbablePrime(BigInt{"1000000014000000049"}));
+
+    EXPECT_THROW(IsStrongProbablePrime(BigInt{10}, BigInt{2}), std::domain_error);
+}
+
+TEST(PrimalityTest, BaseIsReducedModuloValue)
+{
+    // 5000000002 = 1896 (mod 2047), -2045 = 2 (mod 2047)
+    EXPECT_FALSE(IsStrongProbablePrime(BigInt{2047}, BigInt{1896}));
+    EXPECT_FALSE(IsStrongProbablePrime(BigInt{2047}, BigInt{5000000002}));
+    EXPECT_TRUE(IsStrongProbablePrime(BigInt{2047}, BigInt{-2045}));
+    EXPECT_TRUE(IsStrongProbablePrime(BigInt{2047}, BigInt{2049}));
+    // divisible by 5: plain PowMod
+    EXPECT_EQ(IsStrongProbablePrime(BigInt{1105}, BigInt{-1103}), IsStrongProbablePrime(BigInt{1105}, BigInt{2}));
+    EXPECT_THROW(IsStrongProbablePrime(BigInt{2047}, BigInt{0}), std::domain_error);
+    EXPECT_THROW(IsStrongProbablePrime(BigInt{2047}, BigInt{-4094}), std::domain_error);
+}
+
+TEST(PrimalityTest, LargeIntegers)
+{
+    const auto mersenne521 { PowerOfTwo(521) - BigInt{1} };
+    const auto mersenne607 { PowerOfTwo(607) - BigInt{1} };
+    EXPECT_TRUE(IsProbablePrime(mersenne521, 5));
+    EXPECT_TRUE(IsPrime(mersenne607));
+    EXPECT_FALSE(IsProbablePrime(mersenne521 * mersenne607));
+    EXPECT_FALSE(IsProbablePrime(PowerOfTwo(523) - BigInt{1}));
+    EXPECT_FALSE(IsProbablePrime(mersenne521 + BigInt{2}));
+}
+
+TEST(PrimalityTest, NextPrime)
+{
+    EXPECT_EQ(NextPrime(BigInt{-10}), BigInt{2});
+    EXPECT_EQ(NextPrime(BigInt{2}), BigInt{3});
+    EXPECT_EQ(NextPrime(BigInt{3}), BigInt{5});
+    EXPECT_EQ(NextPrime(BigInt{1000}), BigInt{1009});
+    EXPECT_EQ(NextPrime(BigInt{"1000000000000"}), BigInt{"1000000000039"});
+    // 10^100 + 267
+    const auto googol { BigInt{"1" + std::string(100, '0')} };
+    EXPECT_EQ(NextPrime(googol), googol + BigInt{267});
+}
+
+TEST(PrimalityTest, ParallelBatch)
+{
+    std::vector<BigInt> candidates;
+    std::vector<bool> expected;
+    for(int i = 0; i < 64; i++) {
+        candidates.push_back(PowerOfTwo(521) - BigInt{1 + 2 * i});
+        expected.push_back(IsProbablePrime(candidates.back()));
+    }
+    EXPECT_EQ(AreProbablePrimes(candidates, 4), expected);
+    EXPECT_EQ(AreProbablePrimes(candidates, 1), expected);
+    EXPECT_TRUE(AreProbablePrimes({}).empty());
+}
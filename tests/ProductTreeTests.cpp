@@ -0,0 +1,88 @@
+#include "../ProductTree.hpp"
+#include <gtest/gtest.h>
+
+TEST(ProductTreeTest, MatchesSequentialProduct)
+{
+    EXPECT_EQ(ProductTree({}), BigInt{1});
+    EXPECT_EQ(ProductTree({ BigInt{-7} }), BigInt{-7});
+
+    std::vector<BigInt> values;
+    BigInt expected { 1 };
+    for(int i = 1; i <= 300; i++) {
+        values.push_back(BigInt{"123456789123456789"} * BigInt{ i % 2? i: -i });
+        expected *= values.back();
+    }
+    EXPECT_EQ(ProductTree(values), expected);
+    EXPECT_EQ(ProductTree(values, 4), expected);
+}
+
+TEST(FactorialTest, SmallAndLargeArguments)
+{
+    EXPECT_EQ(Factorial(0), BigInt{1});
+    EXPECT_EQ(Factorial(1), BigInt{1});
+    EXPECT_EQ(Factorial(2), BigInt{2});
+    EXPECT_EQ(Factorial(20), BigInt{"2432902008176640000"});
+    EXPECT_EQ(Factorial(30), BigInt{"265252859812191058636308480000000"});
+
+    BigInt expected { 1 };
+    for(int i = 2; i <= 2000; i++) {
+        expected *= BigInt{ i };
+    }
+    EXPECT_EQ(Factorial(2000), expected);
+    EXPECT_EQ(Factorial(2000, 4), expected);
+}
+
+TEST(BinomialTest, SmallAndLargeArguments)
+{
+    EXPECT_EQ(Binomial(0, 0), BigInt{1});
+    EXPECT_EQ(Binomial(5, 6), BigInt{0});
+    EXPECT_EQ(Binomial(5, 2), BigInt{10});
+    EXPECT_EQ(Binomial(1000, 3), BigInt{166167000});
+    EXPECT_EQ(Binomial(100, 50), BigInt{"100891344545564193334812497256"});
+    EXPECT_EQ(Binomial(3000, 1400, 4), Factorial(3000) / (Factorial(1400) * Factorial(1600)));
+}
+
+TEST(RemainderTreeTest, MatchesScalarReminders)
+{
+    EXPECT_TRUE(RemainderTree(BigInt{5}, {}).empty());
+
+    std::vector<BigInt> moduli;
+    for(int i = 1; i <= 200; i++) {
+        moduli.push_back(i % 3? BigInt{ 1000003LL * i }: BigInt{"987654321987654321987654321"} + BigInt{ i });
+    }
+    moduli.push_back(BigInt{1});
+    const auto value { Factorial(1500) + BigInt{"123456789123456789"} };
+    for(auto sign: { 1, -1 }) {
+        const auto x { sign > 0? value: BigInt{0} - value };
+        std::vector<BigInt> expected;
+        for(const auto& modulus: moduli) {
+            auto residue { x % modulus };
+            if( !residue.IsPositive() ) residue += modulus;
+            expected.push_back(residue);
+        }
+        EXPECT_EQ(RemainderTree(x, moduli), expected);
+        EXPECT_EQ(RemainderTree(x, moduli, 4), expected);
+    }
+    EXPECT_THROW(RemainderTree(value, { BigInt{7}, BigInt{0} }), std::domain_error);
+    EXPECT_THROW(RemainderTree(value, { BigInt{-7} }), std::domain_error);
+}
+
+TEST(ChineseRemainderTest, ReconstructsFromResidues)
+{
+    EXPECT_EQ(ChineseRemainder({}, {}), BigInt{0});
+    EXPECT_EQ(ChineseRemainder({ BigInt{2}, BigInt{3}, BigInt{2} }, { BigInt{3}, BigInt{5}, BigInt{7} }), BigInt{23});
+    EXPECT_EQ(ChineseRemainder({ BigInt{-1}, BigInt{12} }, { BigInt{4}, BigInt{5} }), BigInt{7});
+
+    // gcd(i * 100! + 1, j * 100! + 1) divides j - i, so the moduli are pairwise coprime
+    std::vector<BigInt> moduli { BigInt{2} };
+    for(int i = 1; i <= 100; i++) {
+        moduli.push_back(Factorial(100) * BigInt{ i } + BigInt{ 1 });
+    }
+    const auto value { Factorial(2000) };
+    const auto residues { RemainderTree(value, moduli) };
+    EXPECT_EQ(ChineseRemainder(residues, moduli), value);
+    EXPECT_EQ(ChineseRemainder(residues, moduli, 4), value);
+
+    EXPECT_THROW(ChineseRemainder({ BigInt{1} }, {}), std::domain_error);
+    EXPECT_THROW(ChineseRemainder({ BigInt{1}, BigInt{2} }, { BigInt{6}, BigInt{9} }), std::domain_error);
+}
@@ -0,0 +1,100 @@
+#include "../RadixConversion.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+namespace {
+    std::string RandomDigits(std::mt19937& generator, size_t count, unsigned radix) {
+        const std::string digits { "0123456789abcdefghijklmnopqrstuvwxyz" };
+        std::uniform_int_distribution<unsigned> digit { 0, radix - 1 };
+        std::string text(count, '0');
+        for(auto& c: text) {
+            c = digits[digit(generator)];
+        }
+        text.front() = '1';
+        return text;
+    }
+
+    // digit by digit, O(n^2)
+    BigInt Horner(const std::string& text, unsigned radix) {
+        BigInt value;
+        for(auto c: text) {
+            value *= BigInt{ radix };
+            value += BigInt{ c <= '9'? c - '0': c - 'a' + 10 };
+        }
+        return value;
+    }
+}
+
+TEST(RadixConversionTest, Hex)
+{
+    EXPECT_EQ(ToHex(BigInt{0}), "0");
+    EXPECT_EQ(ToHex(BigInt{255}), "ff");
+    EXPECT_EQ(ToHex(BigInt{-4096}), "-1000");
+    EXPECT_EQ(ToHex(BigInt{"18446744073709551616"}), "10000000000000000");
+    EXPECT_EQ(FromHex("0xDEADbeef"), BigInt{3735928559});
+    EXPECT_EQ(FromHex("-0x10"), BigInt{-16});
+    EXPECT_EQ(FromHex("+000ff"), BigInt{255});
+    EXPECT_EQ(FromHex("-0"), BigInt{0});
+    EXPECT_TRUE(FromHex("-0").IsPositive());
+    EXPECT_THROW(FromHex(""), std::domain_error);
+    EXPECT_THROW(FromHex("0x"), std::domain_error);
+    EXPECT_THROW(FromHex("12g"), std::domain_error);
+    EXPECT_THROW(FromHex("0x-1"), std::domain_error);
+    EXPECT_THROW(FromHex("--1"), std::domain_error);
+}
+
+TEST(RadixConversionTest, Bytes)
+{
+    EXPECT_TRUE(ToBytes(BigInt{0}).empty());
+    EXPECT_EQ(ToBytes(BigInt{65535}), (std::vector<std::uint8_t>{ 0xff, 0xff }));
+    EXPECT_EQ(ToBytes(BigInt{-65536}), (std::vector<std::uint8_t>{ 0x01, 0x00, 0x00 }));
+    EXPECT_EQ(FromBytes({ 0x00, 0x00, 0x01, 0x00 }), BigInt{256});
+    EXPECT_EQ(FromBytes({}), BigInt{0});
+
+    // 4096-bit value
+    std::vector<std::uint8_t> bytes(512);
+    std::mt19937 generator { 7 };
+    for(auto& byte: bytes) {
+        byte = static_cast<std::uint8_t>(generator());
+    }
+    bytes.front() |= 1;
+    const auto value { FromBytes(bytes) };
+    EXPECT_EQ(ToBytes(value), bytes);
+    EXPECT_EQ(value, FromHex(ToHex(value)));
+}
+
+TEST(RadixConversionTest, LargeValuesMatchDigitByDigit)
+{
+    std::mt19937 generator { 42 };
+    // long enough for a few levels of recursion both ways
+    for(size_t count: { 1u, 31u, 250u, 3000u }) {
+        const auto hex { RandomDigits(generator, count, 16) };
+        const auto value { FromHex(hex) };
+        EXPECT_EQ(value, Horner(hex, 16)) << count;
+        EXPECT_EQ(ToHex(value), hex);
+        EXPECT_EQ(FromBytes(ToBytes(value)), value);
+    }
+}
+
+TEST(RadixConversionTest, AnyRadix)
+{
+    EXPECT_EQ(ToRadixString(BigInt{-255}, 2), "-11111111");
+    EXPECT_EQ(ToRadixString(BigInt{1295}, 36), "zz");
+    EXPECT_EQ(ToRadixString(BigInt{0}, 7), "0");
+    EXPECT_EQ(FromRadixString("ZZ", 36), BigInt{1295});
+    EXPECT_EQ(FromRadixString("-777", 8), BigInt{-511});
+    EXPECT_THROW(ToRadixString(BigInt{1}, 1), std::domain_error);
+    EXPECT_THROW(FromRadixString("1", 37), std::domain_error);
+    EXPECT_THROW(FromRadixString("2", 2), std::domain_error);
+    EXPECT_THROW(FromRadixString("-", 10), std::domain_error);
+
+    std::mt19937 generator { 1 };
+    for(unsigned radix = 2; radix <= 36; radix++) {
+        const auto text { RandomDigits(generator, 700, radix) };
+        const auto value { FromRadixString(text, radix) };
+        EXPECT_EQ(value, Horner(text, radix)) << radix;
+        EXPECT_EQ(ToRadixString(value, radix), text) << radix;
+    }
+    const BigInt decimal { "-98765432109876543210987654321098765432109876543210" };
+    EXPECT_EQ(ToRadixString(decimal, 10), "-98765432109876543210987654321098765432109876543210");
+}
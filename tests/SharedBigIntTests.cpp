@@ -0,0 +1,103 @@
+#include "../SharedBigInt.hpp"
+#include <gtest/gtest.h>
+#include <future>
+
+TEST(SharedBigIntTest, CopiesShareUntilModified)
+{
+    const SharedBigInt original { BigInt{"123456789123456789123456789"} };
+    EXPECT_FALSE(original.IsShared());
+
+    auto copy { original };
+    EXPECT_TRUE(original.IsShared());
+    EXPECT_EQ(&copy.Get(), &original.Get());
+
+    copy += BigInt{1};
+    EXPECT_FALSE(original.IsShared());
+    EXPECT_FALSE(copy.IsShared());
+    EXPECT_EQ(original.Get(), BigInt{"123456789123456789123456789"});
+    EXPECT_EQ(copy.Get(), BigInt{"123456789123456789123456790"});
+
+    // not shared anymore, so modified in place
+    const auto address { &copy.Get() };
+    copy *= BigInt{-2};
+    EXPECT_EQ(&copy.Get(), address);
+    EXPECT_EQ(copy.Get(), BigInt{"-246913578246913578246913580"});
+}
+
+TEST(SharedBigIntTest, OperandMayBeSharedWithItself)
+{
+    SharedBigInt value { BigInt{"-999999999999999999"} };
+    const auto copy { value };
+    value *= value;
+    EXPECT_EQ(value.Get(), BigInt{"999999999999999998000000000000000001"});
+    EXPECT_EQ(copy.Get(), BigInt{"-999999999999999999"});
+    value -= copy;
+    value %= BigInt{1000};
+    value /= BigInt{-1};
+    EXPECT_EQ(value.Get(), BigInt{0});
+    EXPECT_TRUE(value.Get().IsPositive());
+}
+
+TEST(SharedBigIntTest, WorkersReadSharedValue)
+{
+    BigInt power { 3 };
+    for(int i = 0; i < 10; i++) {
+        power *= power;
+    }
+    const SharedBigInt modulus { power + BigInt{2} };
+    std::vector<std::future<BigInt>> tasks;
+    for(int i = 1; i <= 4; i++) {
+        tasks.push_back(std::async(std::launch::async, [modulus, i]() {
+            // the captured copy shares the coefficients with the original
+            return (BigInt{ i } * modulus) % modulus + BigInt{ i };
+        }));
+    }
+    for(int i = 1; i <= 4; i++) {
+        EXPECT_EQ(tasks[i - 1].get(), BigInt{ i });
+    }
+    EXPECT_FALSE(modulus.IsShared());
+}
+
+TEST(SharedBigIntTest, ModifiedInPlaceAfterReadersDropTheirCopies)
+{
+    SharedBigInt value { BigInt{"123456789123456789123456789"} };
+    std::vector<std::future<bool>> readers;
+    for(int i = 0; i < 4; i++) {
+        readers.push_back(std::async(std::launch::async, [copy = value]() {
+            return copy.Get() == BigInt{"123456789123456789123456789"};
+        }));
+    }
+    for(auto& reader: readers) {
+        EXPECT_TRUE(reader.get());
+    }
+    // the readers' copies are destroyed with their tasks
+    readers.clear();
+    EXPECT_FALSE(value.IsShared());
+    const auto address { &value.Get() };
+    value += BigInt{1};
+    EXPECT_EQ(&value.Get(), address);
+    EXPECT_EQ(value.Get(), BigInt{"123456789123456789123456790"});
+
+    auto moved { std::move(value) };
+    value = moved;
+    EXPECT_TRUE(moved.IsShared());
+    EXPECT_EQ(&value.Get(), address);
+}
+
+TEST(SharedBigIntTest, MovedFromHandleHoldsZero)
+{
+    SharedBigInt value { BigInt{"123456789123456789123456789"} };
+    const auto moved { std::move(value) };
+    EXPECT_EQ(moved.Get(), BigInt{"123456789123456789123456789"});
+    EXPECT_FALSE(moved.IsShared());
+
+    // the moved-from handle may be read, copied and modified
+    EXPECT_EQ(value.Get(), BigInt{0});
+    EXPECT_FALSE(value.IsShared());
+    const auto copy { value };
+    EXPECT_TRUE(value.IsShared());
+    EXPECT_EQ(copy.Get(), BigInt{0});
+    value += BigInt{5};
+    EXPECT_EQ(value.Get(), BigInt{5});
+    EXPECT_EQ(copy.Get(), BigInt{0});
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "../BigInt.hpp"
+#include <random>
+#include <string>
+
+/**
+ * Positive number of @digits random decimal digits, the leading one is 1.
+ */
+inline BigInt RandomNumber(std::mt19937& generator, size_t digits) {
+    std::uniform_int_distribution<int> digit { 0, 9 };
+    std::string number(digits, '0');
+    for(auto& c: number) {
+        c = static_cast<char>('0' + digit(generator));
+    }
+    number.front() = '1';
+    return BigInt{ number };
+}